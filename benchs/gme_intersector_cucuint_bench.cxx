@@ -0,0 +1,256 @@
+﻿/*********************************************************************
+ * @file    gme_intersector_cucuint_bench.cxx
+ * @brief   线线求交answer_int_cur_cur与ACIS int_cur_cur的性能对比
+ * @details 第一部分覆盖分派表中的每一种曲线类型组合；第二部分为与intersector_nurbs_nurbs_test.cpp共用的全部nurbs用例，
+ *          曲线在计时循环外构造，state.range(0)选择求交实现；第三部分逐条求交环境变量CCI_BENCH_CORPUS指定的二进制语料；
+ *          第四部分为直线与密集折线轮廓求交，对比cci_straight_segments_int与逐条线段调用int_cur_cur；第五部分为多圈弹簧求交；
+ *          第六部分为调用者给出小包围盒时的求交
+ * @date    2026.10.17
+ *********************************************************************/
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+
+// GME
+#include "cucuint_util.hxx"
+
+// ACIS
+#include "acis/elldef.hxx"
+#include "acis/exct_int.hxx"
+#include "acis/heldef.hxx"
+#include "acis/intcucu.hxx"
+#include "acis/intcurve.hxx"
+#include "acis/sps3crtn.hxx"
+#include "acis/strdef.hxx"
+#include "acis_utils.hpp"
+
+// 与测试共用的nurbs用例
+#include "../tests/intersector_nurbs_nurbs_cases.hxx"
+
+// state.range(0)的取值
+constexpr int CCI_BENCH_ACIS = 0;  // ACIS int_cur_cur
+constexpr int CCI_BENCH_GME = 1;   // answer_int_cur_cur
+
+// 每个用例分别测试ACIS与GME的实现
+#define CCI_BENCH_REGISTER(Fixture, Name) BENCHMARK_REGISTER_F(Fixture, Name)->ArgName("gme")->Arg(CCI_BENCH_ACIS)->Arg(CCI_BENCH_GME)->Unit(benchmark::kMicrosecond)
+
+//////////////////////////////曲线类型组合//////////////////////////////
+
+class CucuintTypePairBench : public benchmark::Fixture {
+    int level = 0;
+
+  protected:
+    // 按CciCurveKind排列的测试曲线，intcurve与intcurve求交时第二条曲线使用curves[CCI_CURVE_KIND_NUM]
+    std::vector<curve*> curves;
+
+    void SetUp(benchmark::State& state) override {
+        level = initialize_acis();
+        straight* st = ACIS_NEW straight(SPAposition(-5, 0.3, 0), normalise(SPAvector(1, 0.1, 0)), 1);
+        st->limit(SPAinterval(0, 10));
+        ellipse* ell = ACIS_NEW ellipse(SPAposition(0, 0, 0), SPAunit_vector(0, 0, 1), SPAvector(2, 0, 0), 0.5);
+        helix* hel = ACIS_NEW helix(SPAposition(0, 0, -3), SPAunit_vector(0, 0, 1), SPAvector(1.5, 0, 0), 1.0, TRUE, SPAinterval(0, 6 * M_PI));
+        curves = {st, ell, hel, make_wave(1.0), make_wave(-1.0)};
+    }
+
+    void TearDown(benchmark::State& state) override {
+        for(curve* cur: curves) {
+            ACIS_DELETE cur;
+        }
+        curves.clear();
+        terminate_acis(level);
+    }
+
+    // xy平面内的三次波浪形样条曲线，sign为-1时关于x轴对称
+    intcurve* make_wave(double sign) {
+        SPAposition ctrlpts[] = {
+          {-4, -1 * sign, 0},
+          {-2, 2 * sign,  0},
+          {0,  -2 * sign, 0},
+          {2,  2 * sign,  0},
+          {4,  -1 * sign, 0},
+          {5,  1 * sign,  0}
+        };
+        double knots[] = {0, 0, 0, 0, 1, 2, 3, 3, 3, 3};
+        bs3_curve bs = bs3_curve_from_ctrlpts(3, FALSE, FALSE, FALSE, 6, ctrlpts, nullptr, SPAresabs, 10, knots, SPAresabs);
+        return ACIS_NEW intcurve(ACIS_NEW exact_int_cur(bs));
+    }
+};
+
+BENCHMARK_DEFINE_F(CucuintTypePairBench, pair)(benchmark::State& state) {
+    int kind1 = static_cast<int>(state.range(0));
+    int kind2 = static_cast<int>(state.range(1));
+    curve const& c1 = *curves[kind1];
+    curve const& c2 = kind1 == kind2 && kind2 == static_cast<int>(CciCurveKind::Intcurve) ? *curves[CCI_CURVE_KIND_NUM] : *curves[kind2];
+    for(auto _: state) {
+        curve_curve_int* inters = state.range(2) == CCI_BENCH_GME ? answer_int_cur_cur(c1, c2) : int_cur_cur(c1, c2);
+        delete_curve_curve_ints(inters);
+    }
+}
+BENCHMARK_REGISTER_F(CucuintTypePairBench, pair)
+  ->ArgNames({"kind1", "kind2", "gme"})
+  ->Apply([](benchmark::internal::Benchmark* bench) {
+      for(int kind1 = 0; kind1 < CCI_CURVE_KIND_NUM; ++kind1) {
+          for(int kind2 = kind1; kind2 < CCI_CURVE_KIND_NUM; ++kind2) {
+              bench->Args({kind1, kind2, CCI_BENCH_ACIS});
+              bench->Args({kind1, kind2, CCI_BENCH_GME});
+          }
+      }
+  })
+  ->Unit(benchmark::kMicrosecond);
+
+//////////////////////////////nurbs用例//////////////////////////////
+
+class CucuintNurbsBench : public benchmark::Fixture {
+    int level = 0;
+
+  protected:
+    void SetUp(benchmark::State& state) override { level = initialize_acis(); }
+
+    void TearDown(benchmark::State& state) override { terminate_acis(level); }
+
+    // 曲线在计时循环外构造，以相同参数重复调用state.range(0)选择的求交实现
+    template <typename... Args> static void run_case(benchmark::State& state, Args const&... args) {
+        for(auto _: state) {
+            curve_curve_int* inters = state.range(0) == CCI_BENCH_GME ? answer_int_cur_cur(args...) : int_cur_cur(args...);
+            delete_curve_curve_ints(inters);
+        }
+    }
+};
+
+// 曲线构造与测试共用，见intersector_nurbs_nurbs_cases.hxx
+#define CCI_NURBS_CASE_BENCH(Name)                                                          \
+    BENCHMARK_DEFINE_F(CucuintNurbsBench, Name)(benchmark::State& state) {                  \
+        cci_nurbs_case_##Name([&state](auto const&... args) { run_case(state, args...); }); \
+    }                                                                                       \
+    CCI_BENCH_REGISTER(CucuintNurbsBench, Name);
+
+CCI_NURBS_CASES(CCI_NURBS_CASE_BENCH)
+
+//////////////////////////////二进制语料//////////////////////////////
+
+BENCHMARK_DEFINE_F(CucuintNurbsBench, Corpus)(benchmark::State& state) {
+    char const* file_name = std::getenv("CCI_BENCH_CORPUS");
+    CciCorpusFile corpus;
+    if(!file_name || !corpus.open(file_name)) {
+        state.SkipWithError("CCI_BENCH_CORPUS未指定或不是合法的语料文件");
+        return;
+    }
+    // 曲线在计时循环外重建，计时部分只包含求交
+    std::vector<curve*> curves;
+    std::vector<CciCorpusPair> pairs;
+    for(size_t i = 0; i < corpus.size(); ++i) {
+        CciCorpusPair pair = corpus[i];
+        curve* c1 = pair.make_curve(0);
+        curve* c2 = pair.make_curve(1);
+        if(c1 && c2) {
+            curves.push_back(c1);
+            curves.push_back(c2);
+            pairs.push_back(pair);
+        } else {
+            ACIS_DELETE c1;
+            ACIS_DELETE c2;
+        }
+    }
+    for(auto _: state) {
+        for(size_t i = 0; i < pairs.size(); ++i) {
+            curve const& c1 = *curves[2 * i];
+            curve const& c2 = *curves[2 * i + 1];
+            SPAbox box = pairs[i].has_box() ? pairs[i].box() : SPAbox();
+            SPAbox const& region = pairs[i].has_box() ? box : SpaAcis::NullObj::get_box();
+            curve_curve_int* inters = state.range(0) == CCI_BENCH_GME ? answer_int_cur_cur(c1, c2, region, pairs[i].tol()) : int_cur_cur(c1, c2, region, pairs[i].tol());
+            delete_curve_curve_ints(inters);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * pairs.size());
+    for(curve* cur: curves) {
+        ACIS_DELETE cur;
+    }
+}
+CCI_BENCH_REGISTER(CucuintNurbsBench, Corpus);
+
+//////////////////////////////折线轮廓//////////////////////////////
+
+BENCHMARK_DEFINE_F(CucuintNurbsBench, LineSegments)(benchmark::State& state) {
+    // 半径50、步长约0.1的圆形折线轮廓(与points_segments_test中的数据密度相当)，与一条过轮廓的直线求交
+    int num = static_cast<int>(2 * M_PI * 50 / 0.1);
+    std::vector<SPAposition> pts;
+    for(int k = 0; k < num; ++k) {
+        double angle = 2 * M_PI * k / num;
+        pts.push_back(SPAposition(50 * cos(angle), 50 * sin(angle), 0));
+    }
+    CciSegmentArray segs;
+    segs.assign_polyline(pts, true);
+    std::vector<straight*> straights;
+    for(int i = 0; i < segs.size(); ++i) {
+        SPAposition start(segs.x0[i], segs.y0[i], segs.z0[i]), end(segs.x1[i], segs.y1[i], segs.z1[i]);
+        straight* st = ACIS_NEW straight(start, normalise(end - start), 1);
+        st->limit(SPAinterval(0, (end - start).len()));
+        straights.push_back(st);
+    }
+    straight line(SPAposition(-60, 3.7, 0), normalise(SPAvector(1, 0.05, 0)), 1);
+    std::vector<CciSegmentHit> hits;
+
+    for(auto _: state) {
+        if(state.range(0) == CCI_BENCH_GME) {
+            cci_straight_segments_int(line, segs, hits);
+            benchmark::DoNotOptimize(hits.data());
+        } else {
+            for(straight* st: straights) {
+                curve_curve_int* inters = int_cur_cur(line, *st);
+                delete_curve_curve_ints(inters);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * segs.size());
+    for(straight* st: straights) {
+        ACIS_DELETE st;
+    }
+}
+CCI_BENCH_REGISTER(CucuintNurbsBench, LineSegments);
+
+//////////////////////////////多圈弹簧//////////////////////////////
+
+BENCHMARK_DEFINE_F(CucuintNurbsBench, SpringManyTurns)(benchmark::State& state) {
+    // 300圈的弹簧与只穿过其中一圈的直线、圆求交，求交代价应只与相关的圈数有关
+    helix spring(SPAposition(0, 0, 0), SPAunit_vector(0, 0, 1), SPAvector(2, 0, 0), 0.5, TRUE, SPAinterval(0, 600 * M_PI));
+    straight st(SPAposition(-5, 0.3, 70.2), normalise(SPAvector(1, 0.1, 0.01)), 1);
+    st.limit(SPAinterval(0, 10));
+    ellipse cir(SPAposition(0, 2, 75.1), SPAunit_vector(1, 0, 0), SPAvector(0, 0, 0.2), 1.0);
+
+    for(auto _: state) {
+        for(curve const* cur: {static_cast<curve const*>(&st), static_cast<curve const*>(&cir)}) {
+            curve_curve_int* inters = state.range(0) == CCI_BENCH_GME ? answer_int_cur_cur(*cur, spring) : int_cur_cur(*cur, spring);
+            delete_curve_curve_ints(inters);
+        }
+    }
+}
+CCI_BENCH_REGISTER(CucuintNurbsBench, SpringManyTurns);
+
+//////////////////////////////小包围盒求交//////////////////////////////
+
+BENCHMARK_DEFINE_F(CucuintNurbsBench, TightBox)(benchmark::State& state) {
+    // 约200段的样条曲线与直线、圆求交，包围盒只覆盖其中一段，包围盒裁剪后求交核只处理这一段
+    std::vector<SPAposition> pts;
+    std::vector<double> knots = {0, 0, 0};
+    for(int i = 0; i < 202; ++i) {
+        pts.push_back(SPAposition(i, (i % 2) ? 1.0 : -1.0, 0.1 * (i % 3)));
+    }
+    for(int i = 0; i <= 200; ++i) {
+        knots.push_back(i);
+    }
+    knots.push_back(200);
+    knots.push_back(200);
+    bs3_curve bs = bs3_curve_from_ctrlpts(3, FALSE, FALSE, FALSE, static_cast<int>(pts.size()), pts.data(), nullptr, SPAresabs, static_cast<int>(knots.size()), knots.data(), SPAresabs, 3);
+    intcurve ic(ACIS_NEW exact_int_cur(bs));
+    straight st(SPAposition(0, 0.1, 0.05), SPAunit_vector(1, 0, 0), 1);
+    ellipse cir(SPAposition(100.5, 0, 0), SPAunit_vector(0, 0, 1), SPAvector(0.4, 0, 0), 1.0);
+    SPAbox box(SPAposition(100, -2, -1), SPAposition(101, 2, 1));
+
+    for(auto _: state) {
+        for(curve const* cur: {static_cast<curve const*>(&st), static_cast<curve const*>(&cir)}) {
+            curve_curve_int* inters = state.range(0) == CCI_BENCH_GME ? answer_int_cur_cur(ic, *cur, box) : int_cur_cur(ic, *cur, box);
+            delete_curve_curve_ints(inters);
+        }
+    }
+}
+CCI_BENCH_REGISTER(CucuintNurbsBench, TightBox);
@@ -9,9 +9,16 @@
 #pragma once
 
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "acis/base.hxx"
@@ -23,6 +30,7 @@
 #include "acis/intdef.hxx"
 #include "acis/law_util.hxx"
 #include "acis/math.hxx"
+#include "acis/matrix.hxx"
 #include "acis/param.hxx"
 class curve_curve_int;
 class ellipse;
@@ -51,11 +59,80 @@ class spline;
 
 #define GME_INTERSECTOR_INTCUCU_NOINTINTCUR
 
-#define ZeroInter ACIS_NEW curve_curve_int(nullptr, SPAposition(0, 0, 0), 0, 0)
+#define ZeroInter cci_new_inter(nullptr, SPAposition(0, 0, 0), 0, 0)
 
 #define cci_check_coin(inter) (inter->low_rel == curve_curve_rel::cur_cur_coin || inter->high_rel == curve_curve_rel::cur_cur_coin)
 #define cci_check_tangent(inter) (inter->low_rel == curve_curve_rel::cur_cur_tangent && inter->high_rel == curve_curve_rel::cur_cur_tangent)
 
+/**
+ * @brief 单次求交调用内curve_curve_int中间结点的内存池
+ *        结点按块分配，释放的结点进入空闲链表复用，内存池析构时回收所有未释放的结点；
+ *        返回给调用者的结点需先通过materialize替换为ACIS_NEW分配的结点
+ */
+struct CciInterArena {
+    static constexpr int BLOCK_SIZE = 64;
+
+    struct Slot {
+        alignas(curve_curve_int) unsigned char storage[sizeof(curve_curve_int)];
+        Slot* next_free;
+        bool live;
+    };
+
+    // 块按BLOCK_BYTES对齐分配，结点地址向下取整到BLOCK_BYTES的倍数即为所在块的首地址
+    static constexpr size_t BLOCK_BYTES = std::bit_ceil(sizeof(Slot) * BLOCK_SIZE);
+
+    struct BlockDeleter {
+        void operator()(Slot* block) const;
+    };
+
+    std::vector<std::unique_ptr<Slot[], BlockDeleter>> blocks;
+    std::unordered_set<std::uintptr_t> block_addrs;  // 所有块的首地址
+    Slot* free_list = nullptr;
+
+    CciInterArena() = default;
+    CciInterArena(CciInterArena const&) = delete;
+    CciInterArena& operator=(CciInterArena const&) = delete;
+    ~CciInterArena();
+
+    // 在内存池中构造结点
+    curve_curve_int* make(curve_curve_int* next, SPAposition const& pt, double param1, double param2);
+
+    // 析构结点并放回空闲链表，inter必须属于本内存池
+    void release(curve_curve_int* inter);
+
+    // 判断结点是否属于本内存池，按所在块的首地址查找，与块数无关
+    bool owns(curve_curve_int const* inter) const;
+
+    // 将链表中属于本内存池的结点替换为ACIS_NEW分配的结点，返回新链表的首节点
+    curve_curve_int* materialize(curve_curve_int* inters);
+};
+
+/**
+ * @brief 在作用域内将当前线程的curve_curve_int结点分配切换到新的内存池，作用域结束时恢复之前的内存池，可嵌套
+ */
+struct CciInterArenaScope {
+    CciInterArena arena;
+    CciInterArena* previous;
+
+    CciInterArenaScope();
+    ~CciInterArenaScope();
+};
+
+/**
+ * @brief 构造交点结点: 当前线程存在内存池时从内存池分配，否则使用ACIS_NEW
+ */
+curve_curve_int* cci_new_inter(curve_curve_int* next, SPAposition const& pt, double param1, double param2);
+
+/**
+ * @brief 销毁交点结点: 属于当前内存池的结点放回内存池，否则使用ACIS_DELETE
+ */
+void cci_delete_inter(curve_curve_int* inter);
+
+/**
+ * @brief 销毁整个交点链表，并将head置空
+ */
+void cci_delete_inters(curve_curve_int*& head);
+
 /**
  * @brief 将线线求交的单链表组织的所有交点 按照param1升序输出
  * @return 排序后的所有交点的首节点
@@ -178,16 +255,100 @@ void GetQuadraticPoly(double u0, double u1, double u2, double u3, double us, dou
  */
 void GetCubicPoly(double u0, double u1, double u2, double u3, double u4, double us, double ue, double paras[4]);
 
+/** 原生多项式求根器支持的最高次数 */
+constexpr int POLY_ROOT_MAX_DEGREE = 16;
+
+/**
+ * @brief Horner法计算多项式的值
+ * @return 多项式在x处的值
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 自变量
+ */
+double poly_eval(int degree, double const* coef, double x);
+
+/**
+ * @brief Horner法同时计算多项式的值与一阶导数
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 自变量
+ * @param val 输出多项式在x处的值
+ * @param deriv 输出多项式在x处的一阶导数
+ */
+void poly_eval_deriv(int degree, double const* coef, double x, double& val, double& deriv);
+
+/**
+ * @brief 牛顿迭代精化多项式的根，残差不再下降时停止
+ * @return 精化后的根
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 根的初值
+ */
+double poly_newton_polish(int degree, double const* coef, double x);
+
+/**
+ * @brief 数值稳定的二次方程求根 a*x^2 + b*x + c = 0，要求a不为零
+ * @return 根的个数，重根只输出一次
+ * @param roots 输出的根，至少能存放2个值
+ */
+int solve_quadratic_roots(double a, double b, double c, double* roots);
+
+/**
+ * @brief 三次方程求根 x^3 + a*x^2 + b*x + c = 0 (首一)，三实根时用三角形式，否则用Cardano公式
+ * @return 根的个数
+ * @param roots 输出的根，至少能存放3个值
+ */
+int solve_cubic_roots(double a, double b, double c, double* roots);
+
+/**
+ * @brief Ferrari法求四次方程的根 x^4 + a*x^3 + b*x^2 + c*x + d = 0 (首一)
+ * @return 根的个数
+ * @param roots 输出的根，至少能存放4个值
+ */
+int solve_quartic_roots(double a, double b, double c, double d, double* roots);
+
+/**
+ * @brief 计算x处Sturm序列的符号变化次数
+ * @return 符号变化次数
+ * @param seq Sturm序列，每一行为一个多项式的系数，从次数最高的系数开始存储
+ * @param seq_deg 序列中各多项式的次数
+ * @param seq_num 序列中多项式的个数
+ * @param x 自变量
+ */
+int poly_sturm_variations(double const (*seq)[POLY_ROOT_MAX_DEGREE + 1], int const* seq_deg, int seq_num, double x);
+
+/**
+ * @brief Sturm序列隔离[start, end]内的实根，再用牛顿-二分法精化
+ * @return 根的个数，重根只输出一次
+ * @param degree 多项式的次数，不超过POLY_ROOT_MAX_DEGREE
+ * @param coef 多项式的系数，从次数最高的系数开始存储，要求首项系数不为零
+ * @param start
+ * @param end [start, end]为所需要根的参数范围
+ * @param roots 输出的根，至少能存放degree个值
+ */
+int poly_sturm_roots(int degree, double const* coef, double start, double end, double* roots);
+
+/**
+ * @brief 直接在系数数组上求一元多项式方程在[start, end]内的实根，1~4次用求根公式，更高次用Sturm序列隔离
+ * @return 根的个数，根按升序排列，重根只输出一次
+ * @param degree 多项式方程的最高次数，不超过POLY_ROOT_MAX_DEGREE
+ * @param coef 多项式方程的系数，从次数最高的系数开始存储
+ * @param start
+ * @param end [start, end]为所需要根的参数范围
+ * @param roots 输出的根，由调用者提供，至少能存放degree个值
+ */
+int solve_poly_roots(int degree, double const* coef, double start, double end, double* roots);
+
 /**
  * @brief 求一元n次多项式方程的所有根
  * @return 根的个数
  * @param degree 多项式方程的最高次数
  * @param dxyCoef 存储多项式方程的系数，从次数最高的系数开始存储
- * @param root 输出所求得的根，求得的根在[start, end]范围内
+ * @param root 输出所求得的根，求得的根在[start, end]范围内，由调用者提供，至少能存放degree个值
  * @param start
  * @param end [start, end]为所需要根的参数范围
  */
-int Equatn(int degree, double* dxyCoef, double*& root, double start, double end);
+int Equatn(int degree, double* dxyCoef, double* root, double start, double end);
 
 /**
  * @brief 获得样条曲线bs在参数范围[start, end]内的子曲线
@@ -243,42 +404,17 @@ void nurbs_to_multiple_rbeziers(bs3_curve& bs);
 logical check_rational(bs3_curve bs3);
 
 /**
- * @brief 判断sub_curv1和sub_curv2是否在容差tol内完全重合
- * @return TRUE: 完全重合 FALSE: 不完全重合
- * @param sub_curv1 输入曲线1
- * @param sub_curv2 输入曲线2
- * @param tol 重合容差
- * @param reversed sub_curv1和sub_curv2是否参数化相反
- */
-logical test_coin(bs3_curve sub_curv1, bs3_curve sub_curv2, double tol, logical reversed);
-
-/**
- * @brief 判断bs3在param处的点是否为bs3的一个自交点
- * @return FALSE: 该点不是自交点
- *         TRUE: 该点是自交点
- * @param param 输入参数
- * @param bs3 输入曲线
- * @param next_param 输出的参数 若该点不为自交点 next_param为param值
- *                              若该点为自交点 next_param为bs在该自交点处的另一个参数
- * @param tol 容差
+ * @brief 估计样条曲线的高度(内部控制点到首末控制点连线的最大距离)
+ * @return 曲线高度，周期或闭合曲线返回DBL_MAX
+ * @param bs3 输入样条曲线
  */
-logical test_self_inter_point(double param, bs3_curve bs3, double& next_param, double tol = SPAresabs);
+double SPL_BezcHeightEstimate(bs3_curve bs3);
 
-/**
- * @brief 检查曲线curv1在param1，curv2在param2上是否重合
- * @return 0: 不重合 1: 正向重合(切向方向相同) 2: 反向重合(切向方向相反) 3: 多种重合情况(自交点或闭曲线端点)
- * @param curv1 输入曲线1
- * @param curv2 输入曲线2
- * @param param1 输入参数1
- * @param param2 输入参数2
- * @param tol 容差
- * @param check_self_point 是否检查曲线在参数处的自交点和闭曲线的端点
- * @param records 返回的重合记录，包括参数所在点处的所有重合记录 记录格式为<重合关系, param1, param2>
- */
-int test_coincident(bs3_curve curv1, bs3_curve curv2, double param1, double param2, double tol, logical check_self_point = FALSE, std::vector<std::tuple<int, double, double>>* records = nullptr);
+struct CciBezier;
 
 /**
  * @brief 样条曲线重合检测
+ * 两条曲线的Bezier曲线段同步扫描，比较对应子曲线的控制多边形，直接输出最大重合区间，支持任意不超过CCI_BEZIER_MAX_ORDER阶的曲线
  * @return 返回重合的段数 返回0：不重合
  * @param curv1 输入曲线1
  * @param curv2 输入曲线2
@@ -286,8 +422,10 @@ int test_coincident(bs3_curve curv1, bs3_curve curv2, double param1, double para
  * @param inter_ints1 所有重合段在curv1的参数区间
  * @param inter_ints2 所有重合段在curv2的参数区间
  * @param tol 重合检测容差
+ * @param beziers1 curv1已分解的Bezier曲线段，为空时由curv1分解
+ * @param beziers2 curv2已分解的Bezier曲线段，为空时由curv2分解
  */
-int detect_coincident(bs3_curve curv1, bs3_curve curv2, curve_curve_int*& inters, std::vector<SPAinterval>& inter_ints1, std::vector<SPAinterval>& inter_ints2, double tol = SPAresabs);
+int detect_coincident(bs3_curve curv1, bs3_curve curv2, curve_curve_int*& inters, std::vector<SPAinterval>& inter_ints1, std::vector<SPAinterval>& inter_ints2, double tol = SPAresabs, std::vector<CciBezier> const* beziers1 = nullptr, std::vector<CciBezier> const* beziers2 = nullptr);
 
 /**
  * @brief 剔除交点结果inters在所有重合参数区间coin_ints内的交点，只检查param1
@@ -594,6 +732,34 @@ void maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, cur
  */
 logical construct_curvature_circle(curve const& cur, double param, ellipse& ell, double& max_lg);
 
+/**
+ * @brief MAF方法对单个近似交点的求精结果
+ */
+struct CciMafSeedResult {
+    bool finished = false;  // 是否收敛为交点
+    SPAposition int_point;  // 交点位置(两曲线上对应点的中点)
+    bool tangent = false;   // 交点处两曲线是否相切
+    double distance = 0.0;  // 两曲线上对应点的距离
+};
+
+/**
+ * @brief 设置MAF并行求精的最少近似交点个数，为0时关闭并行求精(默认)
+ * 并行求精使用ACIS的thread_work_base工作线程，需要调用者先调用thread_work_base::initialize创建工作线程
+ */
+void cci_set_parallel_refine(int min_seeds);
+
+/**
+ * @brief 获得MAF并行求精的最少近似交点个数，为0表示关闭并行求精
+ */
+int cci_parallel_refine_min_seeds();
+
+/**
+ * @brief 在thread_work_base工作线程上对0 ~ n - 1调用task，工作线程从共享的计数器领取下标，先完成的线程继续领取剩余任务
+ * 任务出错时不再领取剩余任务，所有工作线程结束后在调用线程上以第一个错误号调用sys_error，与串行调用task时的行为一致
+ * @return 未开启并行求精、n小于设置的最少个数、没有工作线程或当前已在工作线程中时返回false，此时不调用task
+ */
+bool cci_parallel_refine(int n, std::function<void(int)> const& task);
+
 /**
  * @brief 封装MAF方法，对近似交点结果near_result迭代求精(GME版本)
  * @param cur1 曲线1
@@ -621,6 +787,42 @@ logical quadratic_approximation_iterate(curve* cur1, curve* cur2, double param1,
 // 将曲线所在的x轴和y轴拉伸extend_magnitude倍
 void extend_curve(curve*& curve1, double extend_magnitude = 1000);
 
+/**
+ * @brief 曲线参数范围外的延拓方式
+ */
+enum class CciExtension {
+    linear,    // 沿端点切线延拓
+    curvature  // 以端点处的二阶Taylor展开延拓，保持曲率连续
+};
+
+/**
+ * @brief 曲线经仿射变换(局部坐标系变换、xy方向拉伸)后的求值包装，代替transf_curve、extend_curve对曲线的拷贝
+ * 变换后的位置为mat * p + offset，导数为mat * p'；有界曲线在参数范围外按extension解析延拓，原曲线始终只读
+ */
+struct CciCurveView {
+    curve const* cur;
+    SPAmatrix mat;      // 变换的线性部分
+    SPAvector offset;   // 变换的平移部分
+    SPAinterval range;  // 原曲线的参数范围
+    CciExtension extension;
+
+    explicit CciCurveView(curve const& c, CciExtension ext = CciExtension::curvature);
+
+    /**
+     * @brief 继续变换到(cp, vx, vy, vz)的局部坐标系中，与transf_curve一致
+     */
+    void transform(SPAposition const& cp, SPAvector const& vx, SPAvector const& vy, SPAvector const& vz);
+
+    /**
+     * @brief 继续将x轴和y轴拉伸extend_magnitude倍，与extend_curve一致
+     */
+    void scale_xy(double extend_magnitude);
+
+    void eval(double t, SPAposition& pos, SPAvector& d1, SPAvector& d2) const;
+    SPAposition eval_position(double t) const;
+    SPAvector eval_deriv(double t) const;
+};
+
 /**
  * @brief 已知cur1和cur2完全重合(参数范围内)，求cur1在coin_int1和cur2在coin_int2的重合段
  */
@@ -660,6 +862,36 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
  */
 curve* law_int_cur_to_curve(intcurve const& law_ic);
 
+/**
+ * @brief nurbs曲线分解得到的有理Bezier曲线段，齐次坐标(w*x, w*y, w*z, w)按分量连续存储(SoA)
+ * @note 第i段的第k个控制点位于下标 i*(degree+1)+k，第i段的参数区间为[t[i], t[i+1]]；重复使用同一对象可避免重新分配内存
+ */
+struct NurbsBezierSpans {
+    int degree = 0;
+    int num_spans = 0;
+    std::vector<double> x, y, z, w;
+    std::vector<double> t;
+};
+
+/**
+ * @brief Boehm节点插入直接在控制点数组上将nurbs曲线分解为Bezier曲线段，不产生中间bs3_curve
+ *        闭曲线和周期曲线先在拷贝上打开；节点向量两端不是完全重节点时逐段用开花求控制点
+ * @return 分解成功返回true；曲线为空或控制点与节点个数不匹配时返回false
+ * @param nurbs 输入的nurbs曲线
+ * @param spans 输出的Bezier曲线段
+ */
+bool NurbscToBezierSpans(bs3_curve nurbs, NurbsBezierSpans& spans);
+
+/**
+ * @brief de Casteljau算法在局部参数s处将齐次坐标交错存储(w*x, w*y, w*z, w)的Bezier曲线分为两段
+ * @param degree Bezier曲线的次数
+ * @param src 输入的控制点，长度为4*(degree+1)
+ * @param s 分割的局部参数
+ * @param left 输出[0, s]段的控制点
+ * @param right 输出[s, 1]段的控制点
+ */
+void NurbsBezierSplit(int degree, double const* src, double s, double* left, double* right);
+
 /**
  * @brief Nurbs曲线细分，转化为控制多边形点数组
  * @param curv 输入的Nurbs曲线
@@ -697,6 +929,25 @@ bool ellipse_ellipse_coin_detect(ellipse const& cci_ellipse1, ellipse const& cci
  */
 curve_curve_int* ellipse_ellipse_coin(ellipse const& cci_ellipse1, ellipse const& cci_ellipse2, SPAbox const& box, double tol);
 
+/**
+ * @brief 共面椭圆求交(结式法): 椭圆1的有理参数化代入椭圆2的隐式方程得到四次方程，根用一步牛顿迭代精化
+ * @return 线线求交结果
+ * @param ell1 输入椭圆1
+ * @param ell2 输入椭圆2，与ell1共面且不重合
+ * @param tol 容差
+ */
+curve_curve_int* coplanar_ellipse_ellipse_int(ellipse const& ell1, ellipse const& ell2, double tol);
+
+/**
+ * @brief 不共面椭圆求交: 转化为两个平面的交线分别与两个椭圆求交
+ * @return 线线求交结果
+ * @param ell1 输入椭圆1
+ * @param ell2 输入椭圆2，所在平面与ell1所在平面不平行
+ * @param box 包围盒
+ * @param tol 容差
+ */
+curve_curve_int* noncoplanar_ellipse_ellipse_int(ellipse const& ell1, ellipse const& ell2, SPAbox const& box, double tol);
+
 /**
  * @brief 根据重合的参数区间(cur1上的参数区间)构造线线求交结果类
  * @return 线线求交结果类
@@ -962,89 +1213,813 @@ double MinDistancePointPair_Impl(curve const& cur1, curve const& cur2, Vector<2>
 double cur1_cur2_MinDistancePointPair_Impl(curve const& cur1, curve const& cur2, Vector<2> const& vec0, SPAposition& pt1, SPAposition& pt2, int maxiter = -1);
 
 /**
- * @brief 给定初始值_x0, 求func的最小值
+ * @brief 给定初始值_x0, 求func的最小值，Nelder-Mead单纯形法，是nelder_mead_minimize的std::function包装
  */
 Vector<2> minimize(ScalarFunc2dType const& func, Vector<2> const& _x0, std::vector<void const*> const& params, double tol = 1e-10, int maxiter = -1, bool adaptive = false);
 
+//////////////////////////////模板化最优化方法//////////////////////////////
+
 /**
- * @brief 获得曲线的包围盒
+ * @brief 计算 a * x + b * y，逐分量展开以避免std::function的调用开销
  */
-SPAbox bound_of_curve(curve const& curv);
+template <size_t N> Vector<N> vector_combine(double a, Vector<N> const& x, double b, Vector<N> const& y) {
+    Vector<N> ret;
+    for(size_t i = 0; i < N; ++i) {
+        ret(i, 0) = a * x(i, 0) + b * y(i, 0);
+    }
+    return ret;
+}
 
 /**
- * @brief 计算三维点到曲线的最短距离
+ * @brief 部分主元高斯消元求解线性方程组 A * x = b
+ * @return A奇异时返回false
  */
-DECL_INTR double distance_to_curve(SPAposition const& pos, curve const& curv);
+template <size_t N> bool solve_linear_system(Matrix<N, N> A, Vector<N> b, Vector<N>& x) {
+    double scale = 0.0;
+    for(size_t i = 0; i < N; ++i) {
+        for(size_t j = 0; j < N; ++j) {
+            scale = D3_max(scale, fabs(A(i, j)));
+        }
+    }
+    if(scale == 0.0) {
+        return false;
+    }
+    for(size_t col = 0; col < N; ++col) {
+        size_t pivot = col;
+        for(size_t i = col + 1; i < N; ++i) {
+            if(fabs(A(i, col)) > fabs(A(pivot, col))) {
+                pivot = i;
+            }
+        }
+        if(fabs(A(pivot, col)) <= 1e-14 * scale) {
+            return false;
+        }
+        if(pivot != col) {
+            for(size_t j = 0; j < N; ++j) {
+                std::swap(A(pivot, j), A(col, j));
+            }
+            std::swap(b(pivot, 0), b(col, 0));
+        }
+        for(size_t i = col + 1; i < N; ++i) {
+            double factor = A(i, col) / A(col, col);
+            for(size_t j = col; j < N; ++j) {
+                A(i, j) -= factor * A(col, j);
+            }
+            b(i, 0) -= factor * b(col, 0);
+        }
+    }
+    for(size_t i = N; i-- > 0;) {
+        double val = b(i, 0);
+        for(size_t j = i + 1; j < N; ++j) {
+            val -= A(i, j) * x(j, 0);
+        }
+        x(i, 0) = val / A(i, i);
+    }
+    return true;
+}
 
 /**
- * @brief 两个nurbs曲线的近似求交
+ * @brief 单纯形顶点按函数值升序原地插入排序
  */
-curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPAinterval const& range1, SPAinterval const& range2, double tol = 0.0);
-
-// 获得区间range去除exclude_ranges后的集合
-void interval_exclude(SPAinterval const& range, std::vector<SPAinterval> const& exclude_ranges, std::vector<SPAinterval>& left_ranges);
+template <size_t N> void simplex_sort(Vector<N> (&sim)[N + 1], double (&fsim)[N + 1]) {
+    for(size_t i = 1; i <= N; ++i) {
+        for(size_t j = i; j > 0 && fsim[j] < fsim[j - 1]; --j) {
+            std::swap(fsim[j], fsim[j - 1]);
+            std::swap(sim[j], sim[j - 1]);
+        }
+    }
+}
 
-// 连接两个线线求交结果
-curve_curve_int* connect_curve_curve_int(curve_curve_int* inter1, curve_curve_int* inter2);
+/**
+ * @brief Nelder-Mead单纯形法求func的最小值，单纯形为定长数组，目标函数以模板参数传入可被内联
+ * @return 最小值点
+ * @param func 目标函数，需提供 double operator()(Vector<N> const&) const
+ * @param x0 初始值
+ * @param tol 单纯形顶点与函数值的收敛容差
+ * @param maxiter 最大迭代次数，-1表示使用默认值N*300
+ * @param adaptive 是否根据维数调整参数
+ */
+template <size_t N, typename Func> Vector<N> nelder_mead_minimize(Func const& func, Vector<N> const& x0, double tol = 1e-10, int maxiter = -1, bool adaptive = false) {
+    double rho = 1, chi = 2, psi = 0.5, sigma = 0.5;
+    if(adaptive) {
+        double dim = static_cast<double>(N);
+        chi = 1 + 2 / dim;
+        psi = 0.75 - 1 / (2 * dim);
+        sigma = 1 - 1 / dim;
+    }
+    const double nonzdelt = 0.05;
+    const double zdelt = 0.00025;
+    if(maxiter == -1) {  // 默认最大迭代次数
+        maxiter = N * 300;
+    }
+    const int maxfun = N * 300;  // 手动设置上界，防止无限循环
+
+    Vector<N> sim[N + 1];
+    double fsim[N + 1];
+    sim[0] = x0;
+    for(size_t k = 0; k < N; ++k) {
+        sim[k + 1] = x0;
+        sim[k + 1](k, 0) = fabs(x0(k, 0)) > 2.22e-16 ? (1 + nonzdelt) * x0(k, 0) : zdelt;
+    }
+    int ncalls = 0;
+    for(size_t k = 0; k <= N; ++k) {
+        fsim[k] = func(sim[k]);
+        ncalls++;
+    }
+    simplex_sort<N>(sim, fsim);  // sim[0]为函数值最小的顶点
+
+    int iterations = 1;
+    while(ncalls < maxfun && iterations < maxiter) {
+        double maxval = 0.0, maxfval = 0.0;
+        for(size_t i = 1; i <= N; ++i) {
+            maxfval = D3_max(maxfval, fabs(fsim[i] - fsim[0]));
+            for(size_t j = 0; j < N; ++j) {
+                maxval = D3_max(maxval, fabs(sim[i](j, 0) - sim[0](j, 0)));
+            }
+        }
+        if(maxval <= tol && maxfval <= tol) {
+            break;
+        }
+        Vector<N> xbar;  // 除最差顶点外的形心
+        for(size_t i = 0; i < N; ++i) {
+            for(size_t j = 0; j < N; ++j) {
+                xbar(j, 0) += sim[i](j, 0) / N;
+            }
+        }
+        Vector<N> xr = vector_combine(1 + rho, xbar, -rho, sim[N]);
+        double fxr = func(xr);
+        ncalls++;
+        bool doshrink = false;
+        if(fxr < fsim[0]) {
+            Vector<N> xe = vector_combine(1 + rho * chi, xbar, -rho * chi, sim[N]);
+            double fxe = func(xe);
+            ncalls++;
+            if(fxe < fxr) {
+                sim[N] = xe;
+                fsim[N] = fxe;
+            } else {
+                sim[N] = xr;
+                fsim[N] = fxr;
+            }
+        } else if(fxr < fsim[N - 1]) {
+            sim[N] = xr;
+            fsim[N] = fxr;
+        } else if(fxr < fsim[N]) {  // 外收缩
+            Vector<N> xc = vector_combine(1 + psi * rho, xbar, -psi * rho, sim[N]);
+            double fxc = func(xc);
+            ncalls++;
+            if(fxc <= fxr) {
+                sim[N] = xc;
+                fsim[N] = fxc;
+            } else {
+                doshrink = true;
+            }
+        } else {  // 内收缩
+            Vector<N> xcc = vector_combine(1 - psi, xbar, psi, sim[N]);
+            double fxcc = func(xcc);
+            ncalls++;
+            if(fxcc < fsim[N]) {
+                sim[N] = xcc;
+                fsim[N] = fxcc;
+            } else {
+                doshrink = true;
+            }
+        }
+        if(doshrink) {
+            for(size_t j = 1; j <= N; ++j) {
+                sim[j] = vector_combine(1 - sigma, sim[0], sigma, sim[j]);
+                fsim[j] = func(sim[j]);
+                ncalls++;
+            }
+        }
+        simplex_sort<N>(sim, fsim);
+        iterations += 1;
+    }
+    return sim[0];
+}
 
 /**
- * @brief 检验curv是否在param处非G1连续
- * @return curv在param处G1不连续，返回FALSE;curv在param处G1连续，返回TRUE
- * @param curv 输入的曲线
- * @param param 输入的曲线参数
- */
-logical check_irregular_G1(bs3_curve curv, double param);
+ * @brief 阻尼牛顿法求func的最小值，Hessian奇异或牛顿方向非下降方向时改用负梯度方向，步长由Armijo回溯线搜索确定
+ * @return 最小值点
+ * @param func 目标函数，需提供 double operator()(Vector<N> const&) const 以及
+ *             double operator()(Vector<N> const&, Vector<N>& grad, Matrix<N, N>& hess) const
+ * @param x0 初始值
+ * @param tol 步长的收敛容差
+ * @param maxiter 最大迭代次数
+ */
+template <size_t N, typename Func> Vector<N> damped_newton_minimize(Func const& func, Vector<N> const& x0, double tol = 1e-10, int maxiter = 100) {
+    Vector<N> x = x0, grad, step;
+    Matrix<N, N> hess;
+    double f = func(x, grad, hess);
+    for(int iter = 0; iter < maxiter; ++iter) {
+        Vector<N> neg_grad = vector_combine(-1.0, grad, 0.0, grad);
+        double slope = 0.0;
+        if(solve_linear_system<N>(hess, neg_grad, step)) {
+            for(size_t i = 0; i < N; ++i) {
+                slope += step(i, 0) * grad(i, 0);
+            }
+        }
+        if(!(slope < 0.0)) {
+            step = neg_grad;
+            slope = -grad.len_sq();
+        }
+        if(!(slope < 0.0)) {  // 梯度为零
+            break;
+        }
+        double t = 1.0;
+        bool accepted = false;
+        for(int k = 0; k < 30; ++k) {
+            Vector<N> trial = vector_combine(1.0, x, t, step);
+            if(func(trial) <= f + 1e-4 * t * slope) {
+                x = trial;
+                accepted = true;
+                break;
+            }
+            t *= 0.5;
+        }
+        if(!accepted) {
+            break;
+        }
+        f = func(x, grad, hess);
+        double step_len = 0.0;
+        for(size_t i = 0; i < N; ++i) {
+            step_len = D3_max(step_len, fabs(t * step(i, 0)));
+        }
+        if(step_len <= tol) {
+            break;
+        }
+    }
+    return x;
+}
 
 /**
- * @brief 返回两个圆的最近的一对点(无交的情况) 或者 所有交点(有交的情况)
- * @return true: 两个圆重合 false: 两个圆不重合
- * @param cir1 输入的圆1
- * @param cir2 输入的圆2
- * @param pos1_array cir1上的最近点
- * @param pos2_array cir2上的最近点
- */
-bool circle_circle_closest_points(ellipse const& cir1, ellipse const& cir2, std::vector<SPAposition>& pos1_array, std::vector<SPAposition>& pos2_array);
+ * @brief Levenberg-Marquardt法求解非线性最小二乘问题 min |r(x)|^2
+ * @return 最小二乘解
+ * @param func 残差函数，需提供 void operator()(Vector<N> const&, Vector<M>& res, Matrix<M, N>& jac) const
+ * @param x0 初始值
+ * @param tol 步长的收敛容差
+ * @param maxiter 最大迭代次数
+ */
+template <size_t M, size_t N, typename Func> Vector<N> levenberg_marquardt_solve(Func const& func, Vector<N> const& x0, double tol = 1e-12, int maxiter = 50) {
+    Vector<N> x = x0;
+    Vector<M> res;
+    Matrix<M, N> jac;
+    func(x, res, jac);
+    double cost = res.len_sq();
+    double lambda = 1e-3;
+    for(int iter = 0; iter < maxiter && cost > 0.0; ++iter) {
+        // 法方程 (J^T J + lambda * diag(J^T J)) * delta = -J^T r
+        Matrix<N, N> jtj;
+        Vector<N> neg_jtr;
+        for(size_t i = 0; i < N; ++i) {
+            for(size_t j = 0; j < N; ++j) {
+                for(size_t k = 0; k < M; ++k) {
+                    jtj(i, j) += jac(k, i) * jac(k, j);
+                }
+            }
+            for(size_t k = 0; k < M; ++k) {
+                neg_jtr(i, 0) -= jac(k, i) * res(k, 0);
+            }
+        }
+        bool improved = false;
+        double step_len = 0.0;
+        for(; lambda < 1e12; lambda *= 10) {
+            Matrix<N, N> damped = jtj;
+            for(size_t i = 0; i < N; ++i) {
+                damped(i, i) += lambda * (jtj(i, i) > 0.0 ? jtj(i, i) : 1.0);
+            }
+            Vector<N> delta;
+            if(!solve_linear_system<N>(damped, neg_jtr, delta)) {
+                continue;
+            }
+            Vector<N> trial = vector_combine(1.0, x, 1.0, delta);
+            Vector<M> trial_res;
+            Matrix<M, N> trial_jac;
+            func(trial, trial_res, trial_jac);
+            double trial_cost = trial_res.len_sq();
+            if(trial_cost < cost) {
+                x = trial;
+                res = trial_res;
+                jac = trial_jac;
+                cost = trial_cost;
+                lambda = D3_max(lambda * 0.1, 1e-15);
+                for(size_t i = 0; i < N; ++i) {
+                    step_len = D3_max(step_len, fabs(delta(i, 0)));
+                }
+                improved = true;
+                break;
+            }
+        }
+        if(!improved || step_len <= tol) {
+            break;
+        }
+    }
+    return x;
+}
 
 /**
- * @brief 返回直线和圆最近的一对点(无交的情况) 或者 所有交点(有交的情况)
- * @param line 输入的直线
- * @param cir 输入的圆
- * @param pos1_array line上的最近点
- * @param pos2_array cir上的最近点
+ * @brief 二维牛顿迭代的结果及收敛证书
  */
-void line_circle_closest_points(straight const& line, ellipse const& cir, std::vector<SPAposition>& pos1_array, std::vector<SPAposition>& pos2_array);
+struct CciNewton2dResult {
+    Vector<2> x;             // 最后的迭代点
+    double residual = 0.0;   // x处的 max(|F1|, |F2|)
+    double step = 0.0;       // 最后一步的 max(|du|, |dv|)
+    int iterations = 0;      // 牛顿迭代次数
+    bool clamped = false;    // 最后一步被参数范围截断
+    bool converged = false;  // 收敛证书: 残差不超过tol，或未被截断、步长不超过step_tol且Jacobian非奇异(孤立根)
+};
 
 /**
- * @brief 判断一个bs3_curve在[st, ed]内是否为平面曲线
- * @return TRUE: bs3_curve在[st, ed]内为平面曲线, FALSE: bs3_curve在[st, ed]内不是平面曲线
- * @param curv 输入的nurbs曲线
- * @param interval 输入的曲线 [st, ed]
- * @param center 若bs3_curve在[st, ed]内为平面曲线，返回所在平面上一点
- * @param normal 若bs3_curve在[st, ed]内为平面曲线，返回所在平面的法向量
- */
-int bs3_curve_is_planar(bs3_curve curv, SPAinterval const& interval, SPAposition& center = *static_cast<SPAposition*>(nullptr), SPAunit_vector& normal = *static_cast<SPAunit_vector*>(nullptr), double tol = SPAresabs);
+ * @brief 二维阻尼牛顿法求解 F(u, v) = 0: 沿牛顿方向回溯直到残差下降，迭代点截断到参数范围内
+ * @return 迭代结果，converged为false时x为最后的迭代点
+ * @param residual 残差函数 void operator()(Vector<2> const& x, Vector<2>& F) const
+ * @param jacobian Jacobian矩阵 void operator()(Vector<2> const& x, Matrix<2, 2>& J) const，J(i, j) = dFi / dxj
+ * @param x0 初始解
+ * @param range1 u的参数范围，无界的一侧不截断
+ * @param range2 v的参数范围，无界的一侧不截断
+ * @param tol 残差容差
+ * @param step_tol 步长容差
+ * @param max_count 最大迭代次数
+ */
+template <typename Residual, typename Jacobian>
+CciNewton2dResult cci_newton_solve_2d(Residual const& residual, Jacobian const& jacobian, Vector<2> const& x0, SPAinterval const& range1, SPAinterval const& range2, double tol, double step_tol, int max_count = 100) {
+    SPAinterval const* ranges[2] = {&range1, &range2};
+    auto clamp = [&ranges](Vector<2>& x) {
+        bool clamped = false;
+        for(int i = 0; i < 2; ++i) {
+            if(ranges[i]->bounded_below() && x(i, 0) < ranges[i]->start_pt()) {
+                x(i, 0) = ranges[i]->start_pt();
+                clamped = true;
+            } else if(ranges[i]->bounded_above() && x(i, 0) > ranges[i]->end_pt()) {
+                x(i, 0) = ranges[i]->end_pt();
+                clamped = true;
+            }
+        }
+        return clamped;
+    };
+    auto norm = [](Vector<2> const& v) { return D3_max(fabs(v(0, 0)), fabs(v(1, 0))); };
+
+    CciNewton2dResult result;
+    result.x = x0;
+    result.clamped = clamp(result.x);
+    Vector<2> F, trial_F, delta, trial;
+    Matrix<2, 2> J;
+    residual(result.x, F);
+    result.residual = norm(F);
+    while(result.residual > tol && result.iterations < max_count) {
+        jacobian(result.x, J);
+        Vector<2> neg_F = vector_combine(-1.0, F, 0.0, F);
+        if(!solve_linear_system<2>(J, neg_F, delta)) {
+            break;  // Jacobian奇异，牛顿法失效
+        }
+        ++result.iterations;
+        double t = 1.0;
+        bool accepted = false, trial_clamped = false;
+        for(int k = 0; k < 20; ++k) {
+            trial = vector_combine(1.0, result.x, t, delta);
+            trial_clamped = clamp(trial);
+            residual(trial, trial_F);
+            if(norm(trial_F) < result.residual) {
+                accepted = true;
+                break;
+            }
+            t *= 0.5;
+        }
+        if(!accepted) {
+            break;
+        }
+        result.step = D3_max(fabs(trial(0, 0) - result.x(0, 0)), fabs(trial(1, 0) - result.x(1, 0)));
+        result.x = trial;
+        F = trial_F;
+        result.residual = norm(F);
+        result.clamped = trial_clamped;
+        if(result.step <= step_tol) {
+            if(result.residual > tol && !result.clamped) {
+                jacobian(result.x, J);
+                result.converged = solve_linear_system<2>(J, F, delta);
+            }
+            break;
+        }
+    }
+    result.converged = result.converged || result.residual <= tol;
+    return result;
+}
 
 /**
- * @brief 弦截法 求解一元非线性方程的最小值, sol在[a, b]内，要求func(a)*func(b) < 0
- * @param func 一元非线性方程
- * @param a 区间左端
- * @param b 区间右端
- * @param sol 解
- * @param tol 误差
+ * @brief 两条曲线上点的距离平方的一半 f(u, v) = |C1(u) - C2(v)|^2 / 2，供模板化最优化方法使用
  */
-void Secant(std::function<double(double)> const& func, double a, double b, double& sol, double tol = SPAresabs);
+struct CurveDistanceObjective {
+    curve const& cur1;
+    curve const& cur2;
+
+    // 目标函数值
+    double operator()(Vector<2> const& x) const {
+        SPAvector dis_vec = cur1.eval_position(x(0, 0)) - cur2.eval_position(x(1, 0));
+        return 0.5 * (dis_vec % dis_vec);
+    }
+
+    // 目标函数值、梯度与Hessian矩阵
+    double operator()(Vector<2> const& x, Vector<2>& grad, Matrix<2, 2>& hess) const {
+        SPAposition p1, p2;
+        SPAvector u1, u2, v1, v2;
+        cur1.eval(x(0, 0), p1, u1, u2);
+        cur2.eval(x(1, 0), p2, v1, v2);
+        SPAvector dis_vec = p1 - p2;
+        grad(0, 0) = dis_vec % u1;
+        grad(1, 0) = -(dis_vec % v1);
+        hess(0, 0) = u1 % u1 + dis_vec % u2;
+        hess(0, 1) = hess(1, 0) = -(u1 % v1);
+        hess(1, 1) = v1 % v1 - dis_vec % v2;
+        return 0.5 * (dis_vec % dis_vec);
+    }
+
+    // 残差 r = C1(u) - C2(v) 及其Jacobian矩阵
+    void operator()(Vector<2> const& x, Vector<3>& res, Matrix<3, 2>& jac) const {
+        SPAposition p1, p2;
+        SPAvector u1, v1;
+        cur1.eval(x(0, 0), p1, u1);
+        cur2.eval(x(1, 0), p2, v1);
+        SPAvector dis_vec = p1 - p2;
+        for(int i = 0; i < 3; ++i) {
+            res(i, 0) = dis_vec.component(i);
+            jac(i, 0) = u1.component(i);
+            jac(i, 1) = -v1.component(i);
+        }
+    }
+};
 
 /**
- * @brief 判断曲线是否为退化的曲线
- * @return true: 曲线退化 false: 曲线非退化
- * @param cur 输入的曲线
+ * @brief 两条曲线上点的连线与两曲线切向的夹角余弦平方和的一半，交点处取最小值，见intersectF
  */
-bool is_degenerate(curve const& cur);
+struct CurveIntersectObjective {
+    curve const& cur1;
+    curve const& cur2;
+
+    double operator()(Vector<2> const& x) const {
+        double u = x(0, 0), v = x(1, 0);
+        SPAvector ndistance_vec = normalise(cur1.eval_position(u) - cur2.eval_position(v));
+        double f1 = ndistance_vec % normalise(cur1.eval_deriv(u));
+        double f2 = ndistance_vec % normalise(cur2.eval_deriv(v));
+        return 0.5 * (f1 * f1 + f2 * f2);
+    }
+};
 
 /**
- * @brief 考虑容差的向量归一化
+ * @brief 获得曲线的包围盒
  */
-SPAunit_vector cucuint_normalise(SPAvector const& vec, double tol = 1e-16);
+SPAbox bound_of_curve(curve const& curv);
+
+/**
+ * @brief 计算三维点到曲线的最短距离
+ */
+DECL_INTR double distance_to_curve(SPAposition const& pos, curve const& curv);
+
+/**
+ * @brief 两个nurbs曲线的近似求交
+ * 近似交点的位置为两条曲线在单元中点处位置的中点，由CciBs3Evaluator批量求值；曲线无法分解为Bezier曲线段时为原点
+ */
+curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPAinterval const& range1, SPAinterval const& range2, double tol = 0.0);
+
+/** Bezier裁剪求交支持的最高阶数(次数+1) */
+constexpr int CCI_BEZIER_MAX_ORDER = 16;
+
+/**
+ * @brief 有理Bezier曲线段，控制点以齐次坐标(w*x, w*y, w*z, w)存储，局部参数为[0, 1]
+ */
+struct CciBezier {
+    int degree = 0;
+    double pts[CCI_BEZIER_MAX_ORDER][4];
+    double t0 = 0.0, t1 = 1.0;  // 局部参数[0, 1]对应原样条曲线上的参数区间[t0, t1]
+};
+
+struct CciBezierOps;
+
+/**
+ * @brief 将nurbs曲线分解为有理Bezier曲线段
+ * @return 分解成功返回true；曲线阶数超过CCI_BEZIER_MAX_ORDER时返回false
+ * @param nurbs 输入的nurbs曲线
+ * @param beziers 输出的Bezier曲线段，参数区间与nurbs的参数一致
+ */
+bool cci_nurbs_to_beziers(bs3_curve nurbs, std::vector<CciBezier>& beziers);
+
+/**
+ * @brief de Casteljau算法在局部参数s处将Bezier曲线分为两段
+ */
+void cci_bezier_split(CciBezier const& bez, double s, CciBezier& left, CciBezier& right);
+
+/**
+ * @brief 获得Bezier曲线在局部参数区间[a, b]上的子曲线
+ */
+void cci_bezier_sub(CciBezier const& bez, double a, double b, CciBezier& sub, CciBezierOps const* ops = nullptr);
+
+/**
+ * @brief 计算Bezier曲线在局部参数s处的位置和一阶导数(对局部参数)
+ */
+void cci_bezier_eval(CciBezier const& bez, double s, SPAposition& pos, SPAvector& deriv);
+
+/**
+ * @brief 获得Bezier曲线控制多边形的包围盒
+ */
+SPAbox cci_bezier_box(CciBezier const& bez);
+
+/**
+ * @brief 获得Bezier曲线齐次坐标多项式的导曲线(速端曲线)，次数减一；非有理曲线的导曲线权重为1
+ */
+void cci_bezier_hodograph(CciBezier const& bez, CciBezier& hodo);
+
+/**
+ * @brief 次数和有理性在编译期确定的Bezier曲线内核，循环长度固定由编译器展开，非有理曲线省去权重运算
+ * 与cci_bezier_eval、cci_bezier_split、cci_bezier_box、cci_bezier_hodograph的结果一致
+ */
+template <int Degree, bool Rational> struct CciBezierKernel {
+    static_assert(Degree >= 1 && Degree < CCI_BEZIER_MAX_ORDER, "unsupported bezier degree");
+    static constexpr int NUM_COORDS = Rational ? 4 : 3;  // 非有理曲线的权重恒为1，不参与运算
+
+    static void eval(CciBezier const& bez, double s, SPAposition& pos, SPAvector& deriv) {
+        double tmp[Degree + 1][NUM_COORDS];
+        for(int i = 0; i <= Degree; ++i) {
+            for(int k = 0; k < NUM_COORDS; ++k) {
+                tmp[i][k] = bez.pts[i][k];
+            }
+        }
+        double u = 1.0 - s;
+        for(int r = 1; r < Degree; ++r) {
+            for(int i = 0; i <= Degree - r; ++i) {
+                for(int k = 0; k < NUM_COORDS; ++k) {
+                    tmp[i][k] = u * tmp[i][k] + s * tmp[i + 1][k];
+                }
+            }
+        }
+        double h[NUM_COORDS], dh[NUM_COORDS];
+        for(int k = 0; k < NUM_COORDS; ++k) {
+            h[k] = u * tmp[0][k] + s * tmp[1][k];
+            dh[k] = Degree * (tmp[1][k] - tmp[0][k]);
+        }
+        if constexpr(Rational) {
+            pos = SPAposition(h[0] / h[3], h[1] / h[3], h[2] / h[3]);
+            deriv = SPAvector((dh[0] - pos.x() * dh[3]) / h[3], (dh[1] - pos.y() * dh[3]) / h[3], (dh[2] - pos.z() * dh[3]) / h[3]);
+        } else {
+            pos = SPAposition(h[0], h[1], h[2]);
+            deriv = SPAvector(dh[0], dh[1], dh[2]);
+        }
+    }
+
+    static void split(CciBezier const& bez, double s, CciBezier& left, CciBezier& right) {
+        double tmp[Degree + 1][4];
+        for(int i = 0; i <= Degree; ++i) {
+            for(int k = 0; k < 4; ++k) {
+                tmp[i][k] = bez.pts[i][k];
+            }
+        }
+        left.degree = right.degree = Degree;
+        for(int k = 0; k < 4; ++k) {
+            left.pts[0][k] = tmp[0][k];
+            right.pts[Degree][k] = tmp[Degree][k];
+        }
+        double u = 1.0 - s;
+        for(int r = 1; r <= Degree; ++r) {
+            for(int i = 0; i <= Degree - r; ++i) {
+                for(int k = 0; k < NUM_COORDS; ++k) {
+                    tmp[i][k] = u * tmp[i][k] + s * tmp[i + 1][k];
+                }
+            }
+            for(int k = 0; k < 4; ++k) {
+                left.pts[r][k] = tmp[0][k];
+                right.pts[Degree - r][k] = tmp[Degree - r][k];
+            }
+        }
+        double tm = bez.t0 + s * (bez.t1 - bez.t0);
+        left.t0 = bez.t0;
+        left.t1 = tm;
+        right.t0 = tm;
+        right.t1 = bez.t1;
+    }
+
+    static SPAbox box(CciBezier const& bez) {
+        double low[3], high[3];
+        for(int k = 0; k < 3; ++k) {
+            low[k] = high[k] = Rational ? bez.pts[0][k] / bez.pts[0][3] : bez.pts[0][k];
+        }
+        for(int i = 1; i <= Degree; ++i) {
+            for(int k = 0; k < 3; ++k) {
+                double val = Rational ? bez.pts[i][k] / bez.pts[i][3] : bez.pts[i][k];
+                low[k] = std::min(low[k], val);
+                high[k] = std::max(high[k], val);
+            }
+        }
+        return SPAbox(SPAposition(low[0], low[1], low[2]), SPAposition(high[0], high[1], high[2]));
+    }
+
+    static void hodograph(CciBezier const& bez, CciBezier& hodo) {
+        hodo.degree = Degree - 1;
+        hodo.t0 = bez.t0;
+        hodo.t1 = bez.t1;
+        for(int i = 0; i < Degree; ++i) {
+            for(int k = 0; k < NUM_COORDS; ++k) {
+                hodo.pts[i][k] = Degree * (bez.pts[i + 1][k] - bez.pts[i][k]);
+            }
+            if constexpr(!Rational) {
+                hodo.pts[i][3] = 1.0;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Bezier曲线内核的函数表，同一条曲线的所有Bezier曲线段次数和有理性相同，只需在每条曲线上选择一次
+ */
+struct CciBezierOps {
+    void (*eval)(CciBezier const& bez, double s, SPAposition& pos, SPAvector& deriv);
+    void (*split)(CciBezier const& bez, double s, CciBezier& left, CciBezier& right);
+    SPAbox (*box)(CciBezier const& bez);
+    void (*hodograph)(CciBezier const& bez, CciBezier& hodo);
+};
+
+/**
+ * @brief 选择Bezier曲线内核，1~3次曲线使用CciBezierKernel特化的内核，其余使用通用实现
+ */
+CciBezierOps const& cci_bezier_ops(int degree, bool rational);
+
+/**
+ * @brief 选择一条曲线分解得到的Bezier曲线段所用的内核，所有权重均为1时按非有理曲线处理
+ */
+CciBezierOps const& cci_bezier_ops(std::vector<CciBezier> const& beziers);
+
+/**
+ * @brief 控制值为c的Bernstein多项式，其控制多边形凸包与非负半平面相交部分的参数区间
+ * @return 凸包全部在负半平面时返回false
+ * @param degree 多项式的次数
+ * @param c 控制值，第j个控制点为(j/degree, c[j])
+ * @param lo
+ * @param hi [lo, hi]为多项式可能非负的参数区间
+ */
+bool cci_hull_nonneg_range(int degree, double const* c, double& lo, double& hi);
+
+/**
+ * @brief 控制多边形有向包围盒的轴: 弦方向、控制点偏离弦最远的方向及二者的叉积
+ * @param p 控制点
+ * @param num 控制点个数
+ * @param axes 输出的三个正交的轴
+ */
+void cci_polygon_axes(SPAposition const* p, int num, SPAunit_vector axes[3]);
+
+/**
+ * @brief 获得Bezier曲线段组成的曲线在参数区间range上的控制点，其凸包包含该段曲线
+ */
+void cci_bezier_hull(std::vector<CciBezier> const& beziers, SPAinterval const& range, std::vector<SPAposition>& hull);
+
+/**
+ * @brief 两组点凸包的分离轴测试，候选轴为两个有向包围盒的轴、两个弦方向的叉积、坐标轴和两组点中心的连线
+ * @return 找到分离轴时返回true，此时两个凸包的距离大于tol，包含于其中的两段曲线在容差内无交点
+ */
+bool cci_hulls_separated(std::vector<SPAposition> const& hull1, std::vector<SPAposition> const& hull2, double tol);
+
+/**
+ * @brief 以两条样条曲线的控制多边形做分离轴测试，见cci_hulls_separated
+ */
+bool cci_bs3_hulls_separated(bs3_curve bs1, bs3_curve bs2, double tol);
+
+/**
+ * @brief 以fat的控制多边形的有向包围盒(弦方向及其两个法向的平板)裁剪bez的参数区间
+ * @return bez与平板无交时返回false
+ * @param fat 用于构造平板的Bezier曲线
+ * @param bez 被裁剪的Bezier曲线
+ * @param tol 平板加厚的容差
+ * @param smin
+ * @param smax [smin, smax]为bez裁剪后保留的局部参数区间
+ */
+bool cci_bezier_clip(CciBezier const& fat, CciBezier const& bez, double tol, double& smin, double& smax);
+
+/**
+ * @brief Gauss-Newton迭代求精两条Bezier曲线上最近点的局部参数
+ * @param a Bezier曲线1
+ * @param b Bezier曲线2
+ * @param s1 a的局部参数，输入初值，输出求精结果
+ * @param s2 b的局部参数，输入初值，输出求精结果
+ * @param ops1 a的求值内核，为nullptr时使用通用实现
+ * @param ops2 b的求值内核，为nullptr时使用通用实现
+ */
+void cci_bezier_polish(CciBezier const& a, CciBezier const& b, double& s1, double& s2, CciBezierOps const* ops1 = nullptr, CciBezierOps const* ops2 = nullptr);
+
+/**
+ * @brief Bezier裁剪求两个nurbs曲线的交点，横截交点二次收敛至容差内，相切等无法收敛的单元作为近似交点交给MAF求精
+ * @param nurbs1 nurbs曲线1
+ * @param nurbs2 nurbs曲线2
+ * @param tol 求交容差
+ * @param inters 输出收敛的交点，参数为nurbs曲线上的参数
+ * @param seeds 输出未能收敛的近似交点，需要调用curve_curve_maf求精
+ * @param beziers1 nurbs1已分解的Bezier曲线段，为空时由nurbs1分解
+ * @param beziers2 nurbs2已分解的Bezier曲线段，为空时由nurbs2分解
+ * @param boxes1 beziers1中各曲线段的包围盒，为空时由beziers1计算
+ * @param boxes2 beziers2中各曲线段的包围盒，为空时由beziers2计算
+ */
+void bezier_clip_nurbs_inters(bs3_curve nurbs1, bs3_curve nurbs2, double tol, curve_curve_int*& inters, curve_curve_int*& seeds, std::vector<CciBezier> const* beziers1 = nullptr, std::vector<CciBezier> const* beziers2 = nullptr,
+                              std::vector<SPAbox> const* boxes1 = nullptr, std::vector<SPAbox> const* boxes2 = nullptr);
+
+/** 批量求值每组同时计算的参数个数(AVX2下一个__m256d) */
+constexpr int CCI_EVAL_LANES = 4;
+
+/**
+ * @brief 样条曲线的批量求值器，将曲线分解为Bezier曲线段后，每CCI_EVAL_LANES个参数一组用de Casteljau算法同时求值
+ * 编译时开启AVX2(__AVX2__)使用向量指令，否则使用等价的标量实现
+ */
+struct CciBs3Evaluator {
+    int degree = 0;
+    std::vector<double> breaks;  // Bezier曲线段的参数分界点，第i段为[breaks[i], breaks[i + 1]]
+    std::vector<double> pts;     // 各段的齐次控制点(w*x, w*y, w*z, w)，第i段第k个控制点位于(i * (degree + 1) + k) * 4
+    bs3_curve bs3 = nullptr;     // 无法分解为Bezier曲线段时逐点求值的样条曲线，不拥有
+
+    /**
+     * @brief 由样条曲线初始化
+     * @return 曲线阶数超过CCI_BEZIER_MAX_ORDER时返回false，此时eval退化为逐点调用bs3_curve_eval
+     */
+    bool init(bs3_curve nurbs);
+
+    /**
+     * @brief 由已分解的Bezier曲线段(如预处理曲线缓存的结果)初始化
+     */
+    void init(std::vector<CciBezier> const& beziers);
+
+    /**
+     * @brief 计算n个参数处的位置和一阶、二阶导数，参数超出曲线范围时按端部曲线段延拓
+     * @param n 参数个数
+     * @param params 参数数组
+     * @param pos 输出位置，长度为n
+     * @param d1 输出一阶导数，为nullptr时不输出
+     * @param d2 输出二阶导数，为nullptr时不输出
+     */
+    void eval(int n, double const* params, SPAposition* pos, SPAvector* d1 = nullptr, SPAvector* d2 = nullptr) const;
+
+    /**
+     * @brief 计算params中各参数处的位置
+     */
+    std::vector<SPAposition> positions(std::vector<double> const& params) const;
+};
+
+// 获得区间range去除exclude_ranges后的集合
+void interval_exclude(SPAinterval const& range, std::vector<SPAinterval> const& exclude_ranges, std::vector<SPAinterval>& left_ranges);
+
+// 连接两个线线求交结果
+curve_curve_int* connect_curve_curve_int(curve_curve_int* inter1, curve_curve_int* inter2);
+
+/**
+ * @brief 检验curv是否在param处非G1连续
+ * @return curv在param处G1不连续，返回FALSE;curv在param处G1连续，返回TRUE
+ * @param curv 输入的曲线
+ * @param param 输入的曲线参数
+ */
+logical check_irregular_G1(bs3_curve curv, double param);
+
+/**
+ * @brief 返回两个圆的最近的一对点(无交的情况) 或者 所有交点(有交的情况)
+ * @return true: 两个圆重合 false: 两个圆不重合
+ * @param cir1 输入的圆1
+ * @param cir2 输入的圆2
+ * @param pos1_array cir1上的最近点
+ * @param pos2_array cir2上的最近点
+ */
+bool circle_circle_closest_points(ellipse const& cir1, ellipse const& cir2, std::vector<SPAposition>& pos1_array, std::vector<SPAposition>& pos2_array);
+
+/**
+ * @brief 返回直线和圆最近的一对点(无交的情况) 或者 所有交点(有交的情况)
+ * @param line 输入的直线
+ * @param cir 输入的圆
+ * @param pos1_array line上的最近点
+ * @param pos2_array cir上的最近点
+ */
+void line_circle_closest_points(straight const& line, ellipse const& cir, std::vector<SPAposition>& pos1_array, std::vector<SPAposition>& pos2_array);
+
+/**
+ * @brief 判断一个bs3_curve在[st, ed]内是否为平面曲线
+ * @return TRUE: bs3_curve在[st, ed]内为平面曲线, FALSE: bs3_curve在[st, ed]内不是平面曲线
+ * @param curv 输入的nurbs曲线
+ * @param interval 输入的曲线 [st, ed]
+ * @param center 若bs3_curve在[st, ed]内为平面曲线，返回所在平面上一点
+ * @param normal 若bs3_curve在[st, ed]内为平面曲线，返回所在平面的法向量
+ */
+int bs3_curve_is_planar(bs3_curve curv, SPAinterval const& interval, SPAposition& center = *static_cast<SPAposition*>(nullptr), SPAunit_vector& normal = *static_cast<SPAunit_vector*>(nullptr), double tol = SPAresabs);
+
+/**
+ * @brief 弦截法 求解一元非线性方程的最小值, sol在[a, b]内，要求func(a)*func(b) < 0
+ * @param func 一元非线性方程
+ * @param a 区间左端
+ * @param b 区间右端
+ * @param sol 解
+ * @param tol 误差
+ */
+void Secant(std::function<double(double)> const& func, double a, double b, double& sol, double tol = SPAresabs);
+
+/**
+ * @brief 判断曲线是否为退化的曲线
+ * @return true: 曲线退化 false: 曲线非退化
+ * @param cur 输入的曲线
+ */
+bool is_degenerate(curve const& cur);
+
+/**
+ * @brief 考虑容差的向量归一化
+ */
+SPAunit_vector cucuint_normalise(SPAvector const& vec, double tol = 1e-16);
 
 /**
  * @brief 验证重合结果的有效性
@@ -1083,6 +2058,19 @@ logical MinDistancePointPair(straight const& cci_straight, helix const& cci_heli
  */
 logical MinDistancePointPair(ellipse const& cci_ellipse, helix const& cci_helix, SPAposition const& init_pos, SPAposition& pt1, SPAposition& pt2);
 
+/**
+ * @brief 以两条曲线距离平方一半的梯度 (d·C1'(u), -d·C2'(v)) 为残差(d = C1(u) - C2(v))，用cci_newton_solve_2d从x0出发求最近点对
+ *        非周期曲线的参数截断到其参数范围内
+ * @return 迭代结果，x为最近点对在两曲线上的参数
+ * @param tol 残差容差
+ */
+CciNewton2dResult cci_newton_min_distance(curve const& cur1, curve const& cur2, Vector<2> const& x0, double tol);
+
+/**
+ * @brief 用cci_newton_min_distance精化交点: 收敛、最近点对距离不超过tol且与原交点距离不超过tol时更新交点的位置和参数，不处理重合段
+ */
+void cci_newton_polish_inters(curve const& cur1, curve const& cur2, curve_curve_int* inters, double tol);
+
 /**
  * @brief 求直线和intcurve的最近点对(pt1, pt2)  注意: 该接口目前只支持直线和(圆环-平面)面交线求最近点对
  * @return TRUE: 求得的最近点对收敛  FALSE: 求得的最近点对不收敛
@@ -1119,6 +2107,11 @@ void my_save_entity_list(ENTITY_LIST& elist,    // (in) List of the entities to
  */
 DECL_INTR void save_curve_curve_models(curve const& cur1, curve const& cur2, std::string const& file_name);
 
+/**
+ * @brief 将两个曲线及ACIS int_cur_cur的结果(期望交点)追加到二进制语料文件file_name中，用于收集难例
+ */
+DECL_INTR void save_curve_curve_corpus(curve const& cur1, curve const& cur2, std::string const& file_name, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
 /**
  * @brief 求两个曲线的最近点对(使用api_entity_entity_distance)
  * @return 最近点对的距离
@@ -1138,8 +2131,808 @@ double MinDistancePointPair(curve const& cur1, curve const& cur2, SPAposition& p
 bool intcurve_is_circle(bs3_curve curv1, double tol);
 
 /**
- * @brief 剔除重复的交点(暴力剔除，待优化)
- * @param rn 待剔除重复交点的所有交点个数
+ * @brief 交点去重使用的三维均匀网格哈希，网格边长为cell_size，与某点距离不超过cell_size的点必落在其邻近的3x3x3个网格内
+ */
+struct CciPointGrid {
+    struct CellKey {
+        long long x, y, z;
+        bool operator==(CellKey const& other) const { return x == other.x && y == other.y && z == other.z; }
+    };
+    struct CellKeyHash {
+        size_t operator()(CellKey const& key) const {
+            size_t h = std::hash<long long>()(key.x);
+            h ^= std::hash<long long>()(key.y) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            h ^= std::hash<long long>()(key.z) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    double cell_size;
+    std::unordered_map<CellKey, std::vector<int>, CellKeyHash> cells;
+
+    explicit CciPointGrid(double size, size_t expected = 0);
+
+    // 点pos所在网格
+    CellKey key_of(SPAposition const& pos) const;
+
+    // 将编号id记录到点pos所在网格，同一编号可多次插入
+    void insert(SPAposition const& pos, int id);
+
+    // 对点pos邻近3x3x3网格内记录的每个编号调用visitor(id)，同一编号可能被访问多次
+    template <typename Visitor> void visit_near(SPAposition const& pos, Visitor&& visitor) const {
+        CellKey center = key_of(pos);
+        for(long long dx = -1; dx <= 1; ++dx) {
+            for(long long dy = -1; dy <= 1; ++dy) {
+                for(long long dz = -1; dz <= 1; ++dz) {
+                    auto it = cells.find(CellKey{center.x + dx, center.y + dy, center.z + dz});
+                    if(it == cells.end()) {
+                        continue;
+                    }
+                    for(int id: it->second) {
+                        visitor(id);
+                    }
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief 剔除重复的交点，使用边长为SPAresabs的网格哈希查找邻近交点，期望复杂度O(n)
+ * @return 剔除后的交点个数
  * @param rt_raw 待剔除重复交点的所有交点
  */
 int CurvCurvIntPointReduce(curve_curve_int*& rt_raw);
+
+/**
+ * @brief 返回两点的中点
+ */
+SPAposition mid_point(SPAposition const& p1, SPAposition const& p2);
+
+//////////////////////////////线线求交分派表//////////////////////////////
+/**
+ * @brief 线线求交分派表中的曲线类别，作为分派表的下标
+ */
+enum class CciCurveKind { Straight = 0, Ellipse = 1, Helix = 2, Intcurve = 3, Unknown = 4 };
+
+// 分派表中的曲线类别数(不含Unknown)
+constexpr int CCI_CURVE_KIND_NUM = 4;
+
+// 分派表中求交核的类型，与answer_int_cur_cur的参数一致
+using CciKernelType = curve_curve_int* (*)(curve const&, curve const&, SPAbox const&, double);
+
+/**
+ * @brief 交换两条曲线后调用求交核Kernel，再交换求交结果中的param1和param2，用于分派表的下三角
+ */
+template <CciKernelType Kernel> curve_curve_int* cci_swapped_kernel(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    return swap_param(Kernel(c2, c1, box, tol));
+}
+
+/**
+ * @brief 获得曲线在线线求交分派表中的类别
+ * @return 曲线类别，不在分派表中的曲线返回CciCurveKind::Unknown
+ * @param c 输入曲线
+ */
+CciCurveKind cci_curve_kind(curve const& c);
+
+/**
+ * @brief 根据两条曲线的类别查表获得求交核
+ * @return 求交核，表外的曲线类别返回通用求交核general_int_cur_cur
+ * @param c1 曲线1
+ * @param c2 曲线2
+ */
+CciKernelType cci_select_kernel(curve const& c1, curve const& c2);
+
+/**
+ * @brief 获得曲线在包围盒内的有界参数范围，用于将曲线离散为样条曲线
+ * @return true: 获得有界参数范围 false: 曲线无界且无法裁剪
+ * @param cur 输入曲线
+ * @param other 另一条曲线，box为空时使用other的包围盒裁剪cur
+ * @param box 包围盒
+ * @param range 输出的有界参数范围
+ */
+bool cci_bounded_range(curve const& cur, curve const& other, SPAbox const& box, SPAinterval& range);
+
+/**
+ * @brief 获得intcurve在其参数范围内的样条曲线拷贝，参数化与intcurve一致(考虑reversed与subset)
+ * @return 样条曲线拷贝，需要调用者销毁
+ * @param ic 输入的intcurve
+ */
+bs3_curve cci_intcurve_bs3(intcurve const& ic);
+
+// 以下为分派表中的求交核，参数与answer_int_cur_cur一致，c1和c2的类型由分派表保证
+curve_curve_int* general_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* straight_straight_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* straight_ellipse_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* straight_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* straight_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* ellipse_ellipse_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* ellipse_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* ellipse_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* helix_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* helix_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+curve_curve_int* intcurve_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+
+//////////////////////////////螺旋线包络//////////////////////////////
+/**
+ * @brief 螺旋线的包络: 所在圆柱或圆锥的轴线，以及轴向高度和半径关于参数的线性函数
+ *        螺旋线上参数t处的点到轴线的投影高度为h0 + dh * t，到轴线的距离为|r0 + dr * t|，一圈对应的参数长度为turn
+ */
+struct CciHelixEnvelope {
+    SPAposition root;     // 轴线上的点
+    SPAunit_vector axis;  // 轴线方向
+    SPAinterval range;    // 螺旋线的有界参数范围
+    double h0 = 0.0, dh = 0.0;
+    double r0 = 0.0, dr = 0.0;
+    bool radial = false;  // 螺旋线的截面是圆时为true，此时可用半径定位
+    double turn = 0.0;
+
+    /**
+     * @brief 由螺旋线初始化，半径由螺旋线的半径和锥度得到
+     * @return 螺旋线参数范围无界或高度不是参数的线性函数时返回false
+     */
+    bool init(helix const& hel);
+
+    /**
+     * @brief 定位可能与包围盒region相交的圈: 由region在轴向的投影范围和到轴线的最大距离解出参数区间，再按圈切分
+     * @param region 另一条曲线的包围盒
+     * @param tol 容差
+     * @param turns 输出的参数区间，每个区间不超过一圈，按参数升序排列
+     */
+    void localize(SPAbox const& region, double tol, std::vector<SPAinterval>& turns) const;
+};
+
+/**
+ * @brief 螺旋线求交引擎: 用螺旋线的包络(见CciHelixEnvelope)定位与另一条曲线包围盒相交的圈，只在这些圈上逐圈求交并用二维牛顿法精化，
+ *        另一条曲线也是螺旋线时对其同样逐圈定位；包络优先使用预处理曲线缓存的结果
+ * @return 求交结果
+ * @param c1 曲线1
+ * @param hel 螺旋线
+ * @param box 包围盒
+ * @param tol 容差
+ */
+curve_curve_int* cci_helix_engine_int(curve const& c1, helix const& hel, SPAbox const& box, double tol);
+
+//////////////////////////////包围盒裁剪//////////////////////////////
+/**
+ * @brief 用slab方法获得直线在包围盒内的参数范围，不构造包围盒的平面
+ * @return 裁剪后的参数范围有界且非空时返回true
+ * @param root 直线上参数为0的点
+ * @param dir 直线关于参数的导数
+ * @param range 直线的参数范围，可以无界
+ * @param box 包围盒
+ * @param clipped 输出的参数范围
+ */
+bool cci_clip_line_to_box(SPAposition const& root, SPAvector const& dir, SPAinterval const& range, SPAbox const& box, SPAinterval& clipped);
+
+/**
+ * @brief 将曲线的参数范围裁剪为位于包围盒内的子区间: 直线用slab方法，椭圆解析求出各坐标分量穿过包围盒边界的参数，
+ *        螺旋线用包络逐圈定位，样条曲线逐个Bezier曲线段用控制多边形凸包缩小参数区间；子区间可能略大于曲线在包围盒内的部分
+ * @return true: 完成裁剪，ranges为空表示曲线与包围盒不相交 false: 包围盒无界或曲线类型不支持裁剪
+ * @param cur 输入曲线
+ * @param box 包围盒
+ * @param tol 包围盒的扩大量
+ * @param ranges 输出的参数子区间，升序且互不相交
+ */
+bool cci_clip_to_box(curve const& cur, SPAbox const& box, double tol, std::vector<SPAinterval>& ranges);
+
+//////////////////////////////预处理曲线缓存//////////////////////////////
+/**
+ * @brief 曲线预处理得到的派生数据，构造后只读，可在多个线程间共享
+ */
+struct CciPreparedData {
+    CciCurveKind kind = CciCurveKind::Unknown;
+    SPAbox box;                         // bound_of_curve
+    SPAinterval range;                  // 计算派生数据时曲线的参数范围
+    bs3_curve source = nullptr;         // 计算派生数据时intcurve的样条曲线ic.cur()，只用于比较，不持有
+    logical reversed = FALSE;           // 计算派生数据时intcurve是否反向
+    bs3_curve bs3 = nullptr;            // intcurve在其参数范围内的样条曲线，见cci_intcurve_bs3
+    int degree = 0;                     // bs3的次数
+    logical rational = FALSE;           // bs3是否为有理样条
+    bool beziers_valid = false;         // bs3能否分解为Bezier曲线段
+    std::vector<CciBezier> beziers;     // bs3分解得到的Bezier曲线段
+    std::vector<SPAbox> bezier_boxes;   // 每个Bezier曲线段控制多边形的包围盒，见cci_bezier_box
+    int planar = 0;                     // bs3_curve_is_planar的返回值
+    SPAposition plane_center;           // planar为1时bs3所在平面上的点
+    SPAunit_vector plane_normal;        // planar为1时bs3所在平面的法向
+    bool linear = false;                // intcurve的样条曲线高度在SPAresabs内，见SPL_BezcHeightEstimate
+    bool helix_valid = false;           // 螺旋线的包络是否有效
+    CciHelixEnvelope envelope;          // 螺旋线的包络
+
+    CciPreparedData() = default;
+    CciPreparedData(CciPreparedData const&) = delete;
+    CciPreparedData& operator=(CciPreparedData const&) = delete;
+    ~CciPreparedData();
+};
+
+/**
+ * @brief 预处理曲线: 缓存同一条曲线与多条曲线求交时重复计算的派生数据(包围盒、Bezier曲线段及其包围盒、平面性、直线性、次数、螺旋线包络)
+ *        data()只比较曲线的参数范围以及intcurve的样条曲线指针和方向，参数范围或样条曲线改变后自动重新计算；
+ *        曲线被变换或原地修改后需调用invalidate()使缓存失效；可在多个线程间共享，但不能在求交过程中修改曲线
+ */
+class CciPreparedCurve {
+  public:
+    explicit CciPreparedCurve(curve const& cur);
+
+    curve const& get_curve() const { return cur; }
+
+    // 获得与曲线当前状态一致的派生数据，返回的数据在持有期间保持有效
+    std::shared_ptr<CciPreparedData const> data() const;
+
+    // 丢弃已缓存的派生数据
+    void invalidate();
+
+  private:
+    curve const& cur;
+    mutable std::mutex mutex;
+    mutable std::shared_ptr<CciPreparedData const> cached;
+};
+
+/**
+ * @brief 在作用域内向当前线程的求交核提供两条预处理曲线的派生数据，作用域结束时恢复之前的状态，可嵌套
+ */
+struct CciPreparedScope {
+    curve const* curves[2];
+    std::shared_ptr<CciPreparedData const> data[2];
+    CciPreparedScope* previous;
+
+    CciPreparedScope(CciPreparedCurve const& c1, CciPreparedCurve const& c2);
+    // 直接提供两条曲线的派生数据，为nullptr表示该曲线未预处理
+    CciPreparedScope(curve const& c1, std::shared_ptr<CciPreparedData const> data1, curve const& c2, std::shared_ptr<CciPreparedData const> data2);
+    ~CciPreparedScope();
+};
+
+/**
+ * @brief 计算曲线的派生数据
+ */
+std::shared_ptr<CciPreparedData const> cci_prepare_curve(curve const& cur);
+
+/**
+ * @brief 由整条曲线的派生数据得到其子曲线的派生数据: 复用已分解的Bezier曲线段及其包围盒，只重新计算两端被截断的曲线段
+ * @param parent 整条曲线的派生数据
+ * @param sub 整条曲线在子区间上的subset
+ */
+std::shared_ptr<CciPreparedData const> cci_prepare_subset(CciPreparedData const& parent, curve const& sub);
+
+/**
+ * @brief 获得当前线程CciPreparedScope中曲线cur的派生数据
+ * @return cur未预处理时返回nullptr
+ */
+CciPreparedData const* cci_prepared_data(curve const& cur);
+
+/**
+ * @brief 获得intcurve在其参数范围内的样条曲线，曲线已预处理时返回缓存的样条曲线
+ * @return 样条曲线，owned为true时需要调用者销毁
+ * @param ic 输入的intcurve
+ * @param owned 输出返回的样条曲线是否为新建的拷贝
+ */
+bs3_curve cci_prepared_bs3(intcurve const& ic, bool& owned);
+
+/**
+ * @brief 预处理曲线求交，结果与answer_int_cur_cur(c1.get_curve(), c2.get_curve(), box, tol)一致
+ */
+curve_curve_int* answer_int_cur_cur(CciPreparedCurve const& c1, CciPreparedCurve const& c2, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+//////////////////////////////批量线线求交//////////////////////////////
+/**
+ * @brief 包围盒层次结构(BVH)，按包围盒中心在最长轴上的中位数二分，叶结点最多包含LEAF_SIZE个包围盒
+ */
+struct CciBvh {
+    static constexpr int LEAF_SIZE = 4;
+
+    struct Node {
+        SPAbox box;
+        int left = -1, right = -1;  // 子结点在nodes中的下标，叶结点为-1
+        int first = 0, count = 0;   // 叶结点包含的包围盒在indices中的范围
+    };
+
+    std::vector<Node> nodes;          // nodes[0]为根结点
+    std::vector<int> indices;         // 包围盒编号，每个叶结点对应其中连续的一段
+    std::vector<SPAbox> item_boxes;   // 与indices一一对应的包围盒
+
+    /**
+     * @brief 对boxes中编号为ids的有界包围盒建立BVH
+     */
+    void build(std::vector<SPAbox> const& boxes, std::vector<int> const& ids);
+
+    /**
+     * @brief 对与box重叠的每个包围盒编号调用visitor(id)
+     */
+    template <typename Visitor> void query(SPAbox const& box, Visitor&& visitor) const {
+        if(nodes.empty()) {
+            return;
+        }
+        int stack[64];  // 中位数二分保证树高不超过log2(n) + 1
+        int top = 0;
+        stack[top++] = 0;
+        while(top > 0) {
+            Node const& node = nodes[stack[--top]];
+            if(!(node.box && box)) {
+                continue;
+            }
+            if(node.left < 0) {
+                for(int k = node.first; k < node.first + node.count; ++k) {
+                    if(item_boxes[k] && box) {
+                        visitor(indices[k]);
+                    }
+                }
+            } else {
+                stack[top++] = node.left;
+                stack[top++] = node.right;
+            }
+        }
+    }
+
+  private:
+    int build_node(std::vector<SPAbox> const& boxes, std::vector<SPAposition> const& centers, int first, int count);
+};
+
+/**
+ * @brief 批量线线求交结果中的一项
+ */
+struct CciBatchResult {
+    int i;                    // 第一组曲线的下标
+    int j;                    // 第二组曲线的下标
+    curve_curve_int* inters;  // 两条曲线的交点，需要调用者销毁
+};
+
+/**
+ * @brief 获得批量求交中曲线的包围盒(放大tol，并与感兴趣的区域box求交)
+ * @return 曲线在box外时返回false
+ */
+bool cci_batch_box(curve const& cur, SPAbox const& box, double tol, SPAbox& cur_box);
+
+/**
+ * @brief 批量求交的实现，self为true时curves2与curves1相同，只求i < j的曲线对
+ */
+std::vector<CciBatchResult> cci_batch_int(std::vector<curve const*> const& curves1, std::vector<curve const*> const& curves2, bool self, SPAbox const& box, double tol);
+
+/**
+ * @brief 批量求两组曲线两两之间的交点，先用BVH筛选包围盒重叠的曲线对，只对这些曲线对调用answer_int_cur_cur
+ * @return 有交点的曲线对及其交点，按(i, j)升序排列
+ * @param curves1 第一组曲线
+ * @param curves2 第二组曲线
+ * @param box 感兴趣的区域，为空时不限制
+ * @param tol 求交容差
+ */
+std::vector<CciBatchResult> answer_int_cur_cur_batch(std::vector<curve const*> const& curves1, std::vector<curve const*> const& curves2, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+/**
+ * @brief 批量求一组曲线两两之间(i < j)的交点，用于轮廓自交检查，见answer_int_cur_cur_batch
+ */
+std::vector<CciBatchResult> answer_int_cur_cur_batch(std::vector<curve const*> const& curves, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+//////////////////////////////直线与线段组求交//////////////////////////////
+/**
+ * @brief 以结构数组(SoA)存储的线段组，第i条线段为(x0[i], y0[i], z0[i])到(x1[i], y1[i], z1[i])，线段上的参数为[0, 1]
+ */
+struct CciSegmentArray {
+    std::vector<double> x0, y0, z0, x1, y1, z1;
+
+    int size() const { return static_cast<int>(x0.size()); }
+
+    void clear();
+
+    void reserve(int n);
+
+    void push_back(SPAposition const& start, SPAposition const& end);
+
+    /**
+     * @brief 由折线的顶点构造首尾相接的线段，closed为true时追加最后一个顶点到第一个顶点的线段
+     */
+    void assign_polyline(std::vector<SPAposition> const& pts, bool closed = false);
+};
+
+/**
+ * @brief 直线与线段组求交的一个交点
+ */
+struct CciSegmentHit {
+    int index;          // 线段的下标
+    double param;       // 直线上的参数
+    double seg_param;   // 线段上的参数
+    SPAposition point;  // 交点
+    bool coincident;    // 线段与直线重合时为true，此时交点为重合部分的端点
+};
+
+/**
+ * @brief 直线(或射线)与线段组求交，每CCI_EVAL_LANES条线段一组同时计算叉积，编译时开启AVX2(__AVX2__)使用向量指令
+ * @param root 直线上参数为0的点
+ * @param dir 直线的方向，参数t对应root + t * dir
+ * @param range 直线的参数范围，无界区间为直线，只有下界的区间为射线
+ * @param segs 线段组
+ * @param hits 输出的交点，按直线参数升序，参数相同时按线段下标升序；折线顶点处的交点由相邻的两条线段各输出一次
+ * @param tol 求交容差
+ */
+void cci_line_segments_int(SPAposition const& root, SPAvector const& dir, SPAinterval const& range, CciSegmentArray const& segs, std::vector<CciSegmentHit>& hits, double tol = SPAresabs);
+
+/**
+ * @brief 直线与线段组求交，直线上的参数与straight::param一致，见cci_line_segments_int
+ */
+void cci_straight_segments_int(straight const& st, CciSegmentArray const& segs, std::vector<CciSegmentHit>& hits, double tol = SPAresabs);
+
+//////////////////////////////存在性与首交点查询//////////////////////////////
+/**
+ * @brief 在作用域内将当前线程的求交设置为只判断是否存在交点，可嵌套
+ *        求交核得到第一个落在box及参数范围内的交点后提前返回，样条曲线只在找不到孤立交点时才检测重合段
+ */
+struct CciExistenceScope {
+    curve const* curves[2];
+    SPAbox const* box;
+    CciExistenceScope* previous;
+
+    CciExistenceScope(curve const& c1, curve const& c2, SPAbox const& box);
+    ~CciExistenceScope();
+};
+
+/**
+ * @brief 当前线程是否处于CciExistenceScope中
+ */
+bool cci_existence_query();
+
+/**
+ * @brief 判断交点是否满足当前CciExistenceScope的要求(在box内，参数在曲线参数范围内)
+ *        cur1、cur2与作用域中的曲线顺序相反时(交换曲线的求交核)交换参数后判断
+ * @return 不在CciExistenceScope中时返回false
+ */
+bool cci_existence_accepts(curve const& cur1, curve const& cur2, SPAposition const& point, double param1, double param2);
+
+/**
+ * @brief 交点链表中是否存在满足当前CciExistenceScope要求的交点，重合段的端点直接视为满足
+ */
+bool cci_existence_found(curve const& cur1, curve const& cur2, curve_curve_int const* inters);
+
+/**
+ * @brief 判断两条曲线在box内是否相交，与answer_int_cur_cur(c1, c2, box, tol)非空等价
+ *        包围盒不重叠时直接返回，求交核得到第一个交点后提前返回，不计算交点关系也不排序
+ */
+bool curves_intersect(curve const& c1, curve const& c2, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+/**
+ * @brief 求c1上的第一个交点，即answer_int_cur_cur(c1, c2, box, tol)中param1最小的交点
+ *        只对该交点计算交点关系，不对全部交点排序
+ * @return 单个交点，没有交点时返回nullptr，需要调用者销毁
+ */
+curve_curve_int* first_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+//////////////////////////////曲线对二进制语料//////////////////////////////
+// 语料文件由CciCorpusHeader和若干条记录顺序组成，字段按本机字节序存放且均按8字节对齐，映射到内存后可直接读取
+// 每条记录依次为: CciCorpusRecord, 曲线1的CciCorpusCurve及其num_values个double, 曲线2的CciCorpusCurve及其数据, num_expected个CciCorpusInter
+// 曲线数据:
+//   straight: root_point(3), direction(3), param_scale
+//   ellipse: centre(3), normal(3), major_axis(3), radius_ratio, param_off
+//   helix: axis_root(3), axis_dir(3), start_disp(3), pitch, par_scaling, taper, helix_range(2)，handedness存放于flags
+//   intcurve: 控制点(3 * num_ctrlpts), 权值(有理时num_ctrlpts个), 节点(num_knots)，保存的是参数化与intcurve一致的样条曲线(见cci_intcurve_bs3)
+
+constexpr char CCI_CORPUS_MAGIC[8] = {'G', 'M', 'E', 'C', 'C', 'I', 'B', '\0'};
+constexpr uint32_t CCI_CORPUS_VERSION = 1;
+constexpr uint32_t CCI_CORPUS_BYTE_ORDER = 0x01020304;  // 读取时用于检查字节序
+
+// CciCorpusRecord::flags
+constexpr uint32_t CCI_CORPUS_HAS_BOX = 1u << 0;    // 记录了感兴趣的区域box
+constexpr uint32_t CCI_CORPUS_RECORDED = 1u << 1;  // 由调用记录器写入，期望交点为当时answer_int_cur_cur的输出
+
+// CciCorpusCurve::flags
+constexpr uint32_t CCI_CORPUS_SUBSET = 1u << 0;      // 解析曲线记录了subset范围
+constexpr uint32_t CCI_CORPUS_RATIONAL = 1u << 1;    // 有理样条曲线
+constexpr uint32_t CCI_CORPUS_CLOSED = 1u << 2;      // 闭样条曲线
+constexpr uint32_t CCI_CORPUS_PERIODIC = 1u << 3;    // 周期样条曲线
+constexpr uint32_t CCI_CORPUS_HANDEDNESS = 1u << 4;  // 右旋螺旋线
+
+/**
+ * @brief 语料文件头
+ */
+struct CciCorpusHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+};
+
+/**
+ * @brief 一条曲线对记录的头部
+ */
+struct CciCorpusRecord {
+    uint32_t size;          // 整条记录的字节数，为8的倍数
+    uint32_t flags;         // CCI_CORPUS_HAS_BOX
+    uint32_t num_expected;  // 期望交点个数
+    uint32_t elapsed_us;    // 调用记录器记录的求交耗时(微秒)，其余记录为0
+    double tol;     // 求交容差
+    double box[6];  // box的low与high
+};
+
+/**
+ * @brief 一条曲线的头部，曲线数据紧随其后
+ */
+struct CciCorpusCurve {
+    uint32_t kind;  // CciCurveKind
+    uint32_t flags;
+    int32_t degree;       // 样条曲线的阶数
+    int32_t num_ctrlpts;  // 样条曲线的控制点个数
+    int32_t num_knots;    // 样条曲线的节点个数
+    int32_t num_values;   // 曲线数据的double个数
+    double subset[2];     // 解析曲线的subset范围
+};
+
+/**
+ * @brief 一个期望交点
+ */
+struct CciCorpusInter {
+    double point[3];
+    double param1, param2;
+    int32_t low_rel, high_rel;  // curve_curve_rel
+};
+
+/**
+ * @brief 将曲线对及其期望交点编码为一条记录，追加到record末尾
+ * @return 曲线类型不在分派表中时返回false，record不变
+ * @param flags 附加的CciCorpusRecord::flags
+ * @param elapsed_us 求交耗时(微秒)
+ */
+bool cci_corpus_encode(curve const& c1, curve const& c2, curve_curve_int const* expected, SPAbox const& box, double tol, std::vector<char>& record, uint32_t flags = 0, uint32_t elapsed_us = 0);
+
+/**
+ * @brief 语料中一条记录的只读视图，指针指向映射的文件内容
+ */
+struct CciCorpusPair {
+    CciCorpusRecord const* record = nullptr;
+    CciCorpusCurve const* curves[2] = {nullptr, nullptr};
+    double const* values[2] = {nullptr, nullptr};
+    CciCorpusInter const* expected = nullptr;
+
+    /**
+     * @brief 构造第k(0或1)条曲线
+     * @return ACIS_NEW创建的曲线，需要调用者销毁；曲线类型或曲线数据的个数不合法时返回nullptr
+     */
+    curve* make_curve(int k) const;
+
+    /**
+     * @brief 构造期望交点链表，需要调用者销毁
+     */
+    curve_curve_int* make_expected() const;
+
+    bool has_box() const { return record->flags & CCI_CORPUS_HAS_BOX; }
+    SPAbox box() const;  // has_box()为true时有效
+    double tol() const { return record->tol; }
+};
+
+/**
+ * @brief 内存中语料的只读视图，init检查文件头、记录长度及各曲线的类型与数据个数，建立记录的偏移表，不解析曲线数据
+ */
+class CciCorpusView {
+  public:
+    /**
+     * @brief 使用data开始的size字节作为语料，data需按8字节对齐且在视图使用期间有效
+     * @return 文件头、记录长度、曲线类型或曲线数据的个数不合法时返回false
+     */
+    bool init(void const* data, size_t size);
+
+    size_t size() const { return offsets.size(); }
+    CciCorpusPair operator[](size_t i) const;
+
+  protected:
+    char const* base = nullptr;
+    std::vector<size_t> offsets;
+};
+
+/**
+ * @brief 将语料文件映射到内存中读取
+ */
+class CciCorpusFile: public CciCorpusView {
+  public:
+    CciCorpusFile() = default;
+    CciCorpusFile(CciCorpusFile const&) = delete;
+    CciCorpusFile& operator=(CciCorpusFile const&) = delete;
+    ~CciCorpusFile();
+
+    /**
+     * @brief 映射并检查语料文件
+     * @return 文件无法打开或不是合法的语料时返回false
+     */
+    bool open(std::string const& file_name);
+    void close();
+
+  private:
+    void* mapped = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#endif
+};
+
+/**
+ * @brief 向语料文件追加记录，文件不存在或为空时先写入文件头，可在多个线程中同时写入
+ */
+class CciCorpusWriter {
+  public:
+    explicit CciCorpusWriter(std::string const& file_name);
+    CciCorpusWriter(CciCorpusWriter const&) = delete;
+    CciCorpusWriter& operator=(CciCorpusWriter const&) = delete;
+    ~CciCorpusWriter();
+
+    bool is_open() const { return file != nullptr; }
+
+    /**
+     * @brief 追加一条曲线对记录
+     * @return 文件未打开或曲线类型不支持时返回false
+     */
+    bool write(curve const& c1, curve const& c2, curve_curve_int const* expected, SPAbox const& box = SpaAcis::NullObj::get_box(), double tol = SPAresabs);
+
+    /**
+     * @brief 追加一条已编码的记录(见cci_corpus_encode)
+     */
+    bool append(std::vector<char> const& record);
+
+  private:
+    bool write_locked(std::vector<char> const& record);
+
+    FILE* file = nullptr;
+    std::mutex mutex;
+    std::vector<char> buffer;
+};
+
+//////////////////////////////求交调用记录//////////////////////////////
+// 开启后answer_int_cur_cur的每次调用结束时判断是否记录: 耗时不少于min_seconds的调用中每sample_every次记录一次，
+// 记录为一条二进制语料记录(带CCI_CORPUS_RECORDED标记、耗时及输出交点)，保存在环形缓冲区中并追加到file_name
+// 记录文件可直接由基准测试CucuintNurbsBench/Corpus(环境变量CCI_BENCH_CORPUS)重放，未开启时每次调用只多一次原子读
+
+/**
+ * @brief 调用记录器的配置
+ */
+struct CciRecorderOptions {
+    std::string file_name;       // 记录文件，为空时只保存在环形缓冲区中
+    double min_seconds = 0.0;    // 只记录耗时不少于该值的调用，用于捕获长尾调用
+    int sample_every = 1;        // 满足耗时要求的调用中每sample_every次记录一次
+    size_t ring_capacity = 256;  // 环形缓冲区保存的最近记录条数，为0时不保存
+};
+
+/**
+ * @brief 按options开启调用记录，已开启时先关闭之前的记录
+ * @return 记录文件无法打开时返回false，此时不开启记录
+ */
+bool cci_recorder_start(CciRecorderOptions const& options);
+
+/**
+ * @brief 关闭调用记录并关闭记录文件，环形缓冲区中的记录保留到下次开启
+ */
+void cci_recorder_stop();
+
+/**
+ * @brief 调用记录是否开启
+ */
+bool cci_recorder_enabled();
+
+/**
+ * @brief 已记录的调用次数(含已移出环形缓冲区的记录)
+ */
+long long cci_recorder_count();
+
+/**
+ * @brief 将环形缓冲区中的记录按时间顺序追加到语料文件file_name中
+ * @return 文件无法打开或写入失败时返回false
+ */
+bool cci_recorder_dump(std::string const& file_name);
+
+/**
+ * @brief 一次answer_int_cur_cur调用的记录范围，最外层且记录器开启时计时，finish时按配置决定是否记录
+ */
+struct CciRecordScope {
+    curve const& c1;
+    curve const& c2;
+    SPAbox const& box;
+    double tol;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+
+    CciRecordScope(curve const& c1, curve const& c2, SPAbox const& box, double tol);
+    ~CciRecordScope();
+
+    /**
+     * @brief 以result为输出结束本次调用
+     */
+    void finish(curve_curve_int const* result);
+};
+
+//////////////////////////////求交统计//////////////////////////////
+// 编译时定义GME_CUCUINT_STATS(CMake选项MODULE_ENABLE_CUCUINT_STATS)开启统计，未定义时统计宏展开为空，不产生任何开销
+
+/**
+ * @brief 求交各阶段的计数项
+ */
+enum class CciCounter {
+    seeds,            // 生成的近似交点(种子)个数
+    refine_iters,     // MAF精化迭代次数
+    bound_calls,      // 曲线bound调用次数
+    invert_calls,     // bs3_curve_invert调用次数
+    coin_tests,       // 重合段检测(控制多边形比较)次数
+    nodes_allocated,  // 分配的交点结点个数
+    nodes_freed,      // 释放的交点结点个数
+    count
+};
+
+/**
+ * @brief 求交各阶段的计时项
+ */
+enum class CciTimer {
+    total,             // answer_int_cur_cur整体
+    near_inters,       // 包围盒细分求近似交点
+    bezier_clip,       // Bezier裁剪求交点
+    refine,            // MAF精化
+    detect_coincident, // 重合段检测
+    point_reduce,      // 交点去重
+    count
+};
+
+/**
+ * @brief 求交统计数据，计时单位为纳秒
+ */
+struct CciStats {
+    long long counters[static_cast<int>(CciCounter::count)] = {};
+    long long timer_ns[static_cast<int>(CciTimer::count)] = {};
+    long long timer_calls[static_cast<int>(CciTimer::count)] = {};
+    long long calls = 0;  // 统计的answer_int_cur_cur调用次数
+
+    void add(CciStats const& other);
+    void subtract(CciStats const& other);
+    /**
+     * @brief 以JSON对象的形式输出统计数据
+     */
+    std::string to_json() const;
+};
+
+/**
+ * @brief 当前线程的累计统计数据
+ */
+CciStats& cci_thread_stats();
+
+/**
+ * @brief 当前线程最近一次answer_int_cur_cur调用的统计数据
+ */
+CciStats const& cci_stats_last_call();
+
+/**
+ * @brief 所有线程已完成的answer_int_cur_cur调用的汇总统计数据
+ */
+CciStats cci_stats_process();
+
+/**
+ * @brief 清空汇总统计数据和当前线程的统计数据
+ */
+void cci_stats_reset();
+
+/**
+ * @brief 作用域计时器，析构时将耗时累加到当前线程的统计数据
+ */
+struct CciScopedTimer {
+    CciTimer timer;
+    std::chrono::steady_clock::time_point start;
+
+    explicit CciScopedTimer(CciTimer t): timer(t), start(std::chrono::steady_clock::now()) {}
+    ~CciScopedTimer();
+    CciScopedTimer(CciScopedTimer const&) = delete;
+    CciScopedTimer& operator=(CciScopedTimer const&) = delete;
+};
+
+/**
+ * @brief 一次answer_int_cur_cur调用的统计范围，最外层范围结束时记录本次调用的统计数据并汇总到进程统计
+ */
+struct CciStatsCallScope {
+    bool outermost;  // 嵌套调用(如批量求交内部)只由最外层记录
+    CciStats begin;
+    std::chrono::steady_clock::time_point start;
+
+    CciStatsCallScope();
+    ~CciStatsCallScope();
+    CciStatsCallScope(CciStatsCallScope const&) = delete;
+    CciStatsCallScope& operator=(CciStatsCallScope const&) = delete;
+};
+
+#ifdef GME_CUCUINT_STATS
+#define CCI_STAT_ADD(counter, n) (cci_thread_stats().counters[static_cast<int>(CciCounter::counter)] += (n))
+#define CCI_STAT_TIMER(timer) CciScopedTimer cci_stat_timer_##timer(CciTimer::timer)
+#define CCI_STAT_CALL() CciStatsCallScope cci_stat_call_scope
+#else
+#define CCI_STAT_ADD(counter, n) ((void)0)
+#define CCI_STAT_TIMER(timer) ((void)0)
+#define CCI_STAT_CALL() ((void)0)
+#endif
+#define CCI_STAT_INC(counter) CCI_STAT_ADD(counter, 1)
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <format>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,1222 @@
 #include "acis/vector_utils.hxx"
 #include "cucuint_util.hxx"
 
-curve_curve_int* answer_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+/**
+ * @brief 获得曲线在包围盒内的有界参数范围，用于将曲线离散为样条曲线
+ * @return true: 获得有界参数范围 false: 曲线无界且无法裁剪
+ * @param cur 输入曲线
+ * @param other 另一条曲线，box为空时使用other的包围盒裁剪cur
+ * @param box 包围盒
+ * @param range 输出的有界参数范围
+ */
+bool cci_bounded_range(curve const& cur, curve const& other, SPAbox const& box, SPAinterval& range) {
+    range = cur.param_range();
+    if(range.finite()) {
+        return true;
+    }
+    if(cur.type() == straight_type) {
+        CciPreparedData const* other_data = cci_prepared_data(other);
+        SPAbox clip_box = &box ? box : enlarge_box(other_data ? other_data->box : bound_of_curve(other), SPAresabs);
+        if(!clip_box.x_range().finite() || !clip_box.y_range().finite() || !clip_box.z_range().finite()) {
+            return false;
+        }
+        straight const& st = static_cast<straight const&>(cur);
+        return cci_clip_line_to_box(st.root_point, st.direction * st.param_scale, range, enlarge_box(clip_box, 1e-6), range);
+    }
+    SPAinterval major_range = curve_major_interval(cur);
+    if(major_range.finite() && !major_range.empty()) {
+        range = major_range;
+        return true;
+    }
+    return false;  // 不支持无界的螺旋线
+}
+
+/**
+ * @brief 获得intcurve在其参数范围内的样条曲线拷贝，参数化与intcurve一致(考虑reversed与subset)
+ * @return 样条曲线拷贝，需要调用者销毁
+ * @param ic 输入的intcurve
+ */
+bs3_curve cci_intcurve_bs3(intcurve const& ic) {
+    SPAinterval range = ic.param_range();
+    if(ic.reversed()) {
+        range = -range;
+    }
+    bs3_curve bs3 = bs3_curve_split_interval(ic.cur(), range.start_pt(), range.end_pt());
+    if(bs3 && ic.reversed()) {
+        bs3_curve_reverse(bs3);
+    }
+    return bs3;
+}
+
+/**
+ * @brief 由两条曲线离散得到的样条曲线求近似交点，通过近似点重新计算原曲线上的参数后用MAF迭代求精
+ * @return 求交结果
+ * @param c1 曲线1
+ * @param bs1 曲线1离散得到的样条曲线
+ * @param c2 曲线2
+ * @param bs2 曲线2离散得到的样条曲线
+ * @param tol 容差
+ */
+static curve_curve_int* cci_approx_int_cur_cur(curve const& c1, bs3_curve bs1, curve const& c2, bs3_curve bs2, double tol) {
+    if(!bs1 || !bs2) {
+        return nullptr;
+    }
+    curve_curve_int* seeds = nurbs_nurbs_near_inters(bs1, bs2, bs3_curve_range(bs1), bs3_curve_range(bs2), tol);
+    // 拟合曲线的参数化与原曲线不一定一致，通过近似点重新计算原曲线上的参数
+    std::vector<double> params1, params2;
+    for(curve_curve_int* seed = seeds; seed; seed = seed->next) {
+        params1.push_back(seed->param1);
+        params2.push_back(seed->param2);
+    }
+    CciBs3Evaluator eval1, eval2;
+    eval1.init(bs1);
+    eval2.init(bs2);
+    std::vector<SPAposition> pos1 = eval1.positions(params1), pos2 = eval2.positions(params2);
+    int k = 0;
+    for(curve_curve_int* seed = seeds; seed; seed = seed->next, ++k) {
+        seed->param1 = c1.param(pos1[k]);
+        seed->param2 = c2.param(pos2[k]);
+    }
+    curve_curve_int* inters = nullptr;
+    curve_curve_maf(c1, c2, seeds, inters, 300);
+    cci_delete_inters(seeds);
+    return inters;
+}
+
+/**
+ * @brief 通用的线线求交: 将两条曲线在有界参数范围内离散为样条曲线，求近似交点后用MAF迭代求精
+ * @return 求交结果
+ */
+curve_curve_int* general_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    SPAinterval range1, range2;
+    if(!cci_bounded_range(c1, c2, box, range1) || !cci_bounded_range(c2, c1, box, range2)) {
+        return nullptr;
+    }
+    bs3_curve bs1 = bs3_curve_make_cur(c1, range1.start_pt(), range1.end_pt());
+    bs3_curve bs2 = bs3_curve_make_cur(c2, range2.start_pt(), range2.end_pt());
+    curve_curve_int* inters = cci_approx_int_cur_cur(c1, bs1, c2, bs2, tol);
+    bs3_curve_delete(bs1);
+    bs3_curve_delete(bs2);
+    return inters;
+}
+
+bool CciHelixEnvelope::init(helix const& hel) {
+    range = hel.param_range();
+    if(!range.finite() || range.length() <= SPAresnor) {
+        return false;
+    }
+    root = hel.axis_root();
+    axis = hel.axis_dir();
+    turn = 2 * M_PI * fabs(hel.par_scaling());
+    // 高度是参数的线性函数，由参数范围两端的点确定
+    double ta = range.start_pt(), tb = range.end_pt();
+    double ha = (hel.eval_position(ta) - root) % axis, hb = (hel.eval_position(tb) - root) % axis;
+    dh = (hb - ha) / (tb - ta);
+    h0 = ha - dh * ta;
+    // 半径按螺旋线的定义r(t) = |start_disp在垂直于轴线平面上的投影| + taper * t / (2 pi par_scaling)，越过圆锥顶点后到轴线的距离为|r(t)|
+    SPAvector disp = hel.start_disp();
+    r0 = (disp - (disp % axis) * axis).len();
+    dr = hel.taper() / (2 * M_PI * hel.par_scaling());
+    // 截面是圆时才能用半径定位: 在相隔1/8圈的4个参数处检查到轴线的距离，中心在轴线上的椭圆截面至少有一处不满足
+    radial = true;
+    for(int k = 0; k < 4; ++k) {
+        double t = ta + k * turn / 8;
+        SPAvector w = hel.eval_position(t) - root;
+        double h = w % axis;
+        if(fabs(h - (h0 + dh * t)) > SPAresabs) {
+            return false;  // 高度不是参数的线性函数，包络不成立
+        }
+        if(fabs((w - h * axis).len() - fabs(r0 + dr * t)) > SPAresabs) {
+            radial = false;
+        }
+    }
+    return true;
+}
+
+void CciHelixEnvelope::localize(SPAbox const& region, double tol, std::vector<SPAinterval>& turns) const {
+    turns.clear();
+    double lo = range.start_pt(), hi = range.end_pt();
+    if(region.x_range().finite() && region.y_range().finite() && region.z_range().finite()) {
+        // 包围盒的角点在轴向的投影范围和到轴线的最大距离
+        double hmin = DBL_MAX, hmax = -DBL_MAX, rmax = 0.0;
+        for(int k = 0; k < 8; ++k) {
+            SPAposition corner((k & 1) ? region.high().x() : region.low().x(), (k & 2) ? region.high().y() : region.low().y(), (k & 4) ? region.high().z() : region.low().z());
+            SPAvector w = corner - root;
+            double h = w % axis;
+            hmin = std::min(hmin, h);
+            hmax = std::max(hmax, h);
+            rmax = std::max(rmax, (w - h * axis).len());
+        }
+        hmin -= tol;
+        hmax += tol;
+        rmax += tol;
+        // h0 + dh * t在[hmin, hmax]内
+        if(fabs(dh) > SPAresnor) {
+            double ta = (hmin - h0) / dh, tb = (hmax - h0) / dh;
+            lo = std::max(lo, std::min(ta, tb));
+            hi = std::min(hi, std::max(ta, tb));
+        } else if(h0 < hmin || h0 > hmax) {
+            return;
+        }
+        // r0 + dr * t不超过rmax，越过圆锥顶点后r0 + dr * t为负，保留这部分参数不会漏掉交点
+        if(radial && fabs(dr) > SPAresnor) {
+            double tr = (rmax - r0) / dr;
+            if(dr > 0) {
+                hi = std::min(hi, tr);
+            } else {
+                lo = std::max(lo, tr);
+            }
+        } else if(radial && r0 > rmax) {
+            return;
+        }
+    }
+    if(hi - lo <= SPAresnor) {
+        return;
+    }
+    // 按从参数范围起点开始的整圈切分
+    double start = range.start_pt();
+    int first = static_cast<int>(floor((lo - start) / turn));
+    for(int k = std::max(first, 0); start + k * turn < hi; ++k) {
+        double a = std::max(lo, start + k * turn), b = std::min(hi, start + (k + 1) * turn);
+        if(b - a > SPAresnor) {
+            turns.push_back(SPAinterval(a, b));
+        }
+    }
+}
+
+/**
+ * @brief 获得螺旋线的包络，优先使用预处理曲线缓存的结果
+ */
+static bool cci_helix_envelope(helix const& hel, CciHelixEnvelope& envelope) {
+    CciPreparedData const* data = cci_prepared_data(hel);
+    if(data && data->helix_valid) {
+        envelope = data->envelope;
+        return true;
+    }
+    return envelope.init(hel);
+}
+
+curve_curve_int* cci_helix_engine_int(curve const& c1, helix const& hel, SPAbox const& box, double tol) {
+    CciHelixEnvelope envelope2;
+    SPAinterval range1;
+    if(!cci_helix_envelope(hel, envelope2) || !cci_bounded_range(c1, hel, box, range1)) {
+        return general_int_cur_cur(c1, hel, box, tol);
+    }
+    CciHelixEnvelope envelope1;
+    bool is_helix1 = c1.type() == helix_type && cci_helix_envelope(static_cast<helix const&>(c1), envelope1);
+
+    curve_curve_int* inters = nullptr;
+    std::vector<SPAinterval> turns1, turns2;
+    envelope2.localize(c1.bound(range1), tol, turns2);
+    // 曲线1不是螺旋线时只离散一次，与螺旋线的各圈求交时共用
+    bs3_curve bs1 = !is_helix1 && !turns2.empty() ? bs3_curve_make_cur(c1, range1.start_pt(), range1.end_pt()) : nullptr;
+    for(auto const& turn2: turns2) {
+        helix sub2(hel);
+        sub2.limit(turn2);
+        if(!is_helix1) {
+            bs3_curve bs2 = bs3_curve_make_cur(sub2, turn2.start_pt(), turn2.end_pt());
+            inters = connect_curve_curve_int(inters, cci_approx_int_cur_cur(c1, bs1, sub2, bs2, tol));
+            bs3_curve_delete(bs2);
+            continue;
+        }
+        // 两条螺旋线时再用这一圈的包围盒定位曲线1的圈
+        envelope1.localize(sub2.bound(turn2), tol, turns1);
+        for(auto const& turn1: turns1) {
+            helix sub1(static_cast<helix const&>(c1));
+            sub1.limit(turn1);
+            inters = connect_curve_curve_int(inters, general_int_cur_cur(sub1, sub2, box, tol));
+        }
+    }
+    bs3_curve_delete(bs1);
+    // 相邻两圈在分界处的交点会被求出两次
+    CurvCurvIntPointReduce(inters);
+    cci_newton_polish_inters(c1, hel, inters, tol);
+    return inters;
+}
+
+bool cci_clip_line_to_box(SPAposition const& root, SPAvector const& dir, SPAinterval const& range, SPAbox const& box, SPAinterval& clipped) {
+    double lo = range.bounded_below() ? range.start_pt() : -DBL_MAX;
+    double hi = range.bounded_above() ? range.end_pt() : DBL_MAX;
+    SPAinterval sides[3] = {box.x_range(), box.y_range(), box.z_range()};
+    for(int k = 0; k < 3; ++k) {
+        double p = root.coordinate(k), d = dir.component(k);
+        double side_lo = sides[k].bounded_below() ? sides[k].start_pt() : -DBL_MAX;
+        double side_hi = sides[k].bounded_above() ? sides[k].end_pt() : DBL_MAX;
+        if(fabs(d) <= SPAresnor * dir.len()) {
+            // 直线与这一对slab平行
+            if(p < side_lo || p > side_hi) {
+                return false;
+            }
+            continue;
+        }
+        double ta = (side_lo - p) / d, tb = (side_hi - p) / d;
+        lo = std::max(lo, std::min(ta, tb));
+        hi = std::min(hi, std::max(ta, tb));
+    }
+    if(lo > hi || !(lo > -DBL_MAX) || !(hi < DBL_MAX)) {
+        return false;
+    }
+    clipped = SPAinterval(lo, hi);
+    return true;
+}
+
+/**
+ * @brief 将参数区间[lo, hi]追加到升序的子区间ranges末尾，与末尾区间相接时合并
+ */
+static void cci_append_clip_range(std::vector<SPAinterval>& ranges, double lo, double hi) {
+    if(!ranges.empty() && lo <= ranges.back().end_pt() + SPAresnor) {
+        ranges.back() = SPAinterval(ranges.back().start_pt(), std::max(hi, ranges.back().end_pt()));
+    } else {
+        ranges.push_back(SPAinterval(lo, hi));
+    }
+}
+
+/**
+ * @brief 椭圆在包围盒内的参数子区间: 坐标分量c_k + A_k cos(t - offset) + B_k sin(t - offset)等于包围盒边界的参数将参数范围分为若干段，
+ *        每段整体在包围盒内或整体在包围盒外，用段中点判断
+ */
+static void cci_clip_ellipse_to_box(ellipse const& ell, SPAbox const& box, std::vector<SPAinterval>& ranges) {
+    SPAinterval range = ell.param_range();
+    double a = range.start_pt(), b = range.end_pt();
+    SPAvector major = ell.major_axis;
+    SPAvector minor = ell.radius_ratio * (ell.normal * ell.major_axis);
+    SPAinterval sides[3] = {box.x_range(), box.y_range(), box.z_range()};
+    std::vector<double> breaks = {a, b};
+    for(int k = 0; k < 3; ++k) {
+        double ak = major.component(k), bk = minor.component(k);
+        double rk = sqrt(ak * ak + bk * bk);
+        if(rk <= SPAresmch) {
+            continue;
+        }
+        // rk * cos(t - phi) = bound - c_k，椭圆参数含有偏移param_off
+        double phi = atan2(bk, ak) + (double)ell.param_off;
+        for(double bound: {sides[k].start_pt(), sides[k].end_pt()}) {
+            double c = (bound - ell.centre.coordinate(k)) / rk;
+            if(fabs(c) >= 1.0) {
+                continue;
+            }
+            double alpha = acos(c);
+            for(double t: {phi - alpha, phi + alpha}) {
+                // 平移整数个周期落入参数范围
+                for(t += 2 * M_PI * ceil((a - t) / (2 * M_PI)); t < b; t += 2 * M_PI) {
+                    breaks.push_back(t);
+                }
+            }
+        }
+    }
+    std::sort(breaks.begin(), breaks.end());
+    for(size_t i = 0; i + 1 < breaks.size(); ++i) {
+        if(breaks[i + 1] > breaks[i] && ell.eval_position(0.5 * (breaks[i] + breaks[i + 1])) << box) {
+            cci_append_clip_range(ranges, breaks[i], breaks[i + 1]);
+        }
+    }
+}
+
+/**
+ * @brief 样条曲线在包围盒内的参数子区间: 对每个Bezier曲线段，坐标分量与包围盒边界之差的齐次形式是Bernstein多项式，
+ *        由其控制多边形凸包求出可能非负的局部参数区间，六个边界的区间取交
+ * @return intcurve无法分解为Bezier曲线段时返回false
+ */
+static bool cci_clip_intcurve_to_box(intcurve const& ic, SPAbox const& box, std::vector<SPAinterval>& ranges) {
+    CciPreparedData const* data = cci_prepared_data(ic);
+    std::vector<CciBezier> local;
+    std::vector<CciBezier> const* beziers = &local;
+    std::vector<SPAbox> const* boxes = nullptr;
+    if(data && data->beziers_valid) {
+        beziers = &data->beziers;
+        boxes = &data->bezier_boxes;
+    } else {
+        bs3_curve bs3 = cci_intcurve_bs3(ic);
+        bool valid = cci_nurbs_to_beziers(bs3, local);
+        bs3_curve_delete(bs3);
+        if(!valid) {
+            return false;
+        }
+    }
+    SPAinterval sides[3] = {box.x_range(), box.y_range(), box.z_range()};
+    for(size_t i = 0; i < beziers->size(); ++i) {
+        CciBezier const& bez = (*beziers)[i];
+        // 已缓存的曲线段包围盒与包围盒不相交时跳过
+        if(boxes && !((*boxes)[i] && box)) {
+            continue;
+        }
+        double lo = 0.0, hi = 1.0;
+        for(int k = 0; k < 3 && lo <= hi; ++k) {
+            for(int side = 0; side < 2 && lo <= hi; ++side) {
+                // 下边界: x_k - lo_k >= 0；上边界: hi_k - x_k >= 0，权重为正，乘以权重后不改变符号
+                double bound = side ? sides[k].end_pt() : sides[k].start_pt();
+                double sign = side ? -1.0 : 1.0;
+                double c[CCI_BEZIER_MAX_ORDER];
+                for(int j = 0; j <= bez.degree; ++j) {
+                    c[j] = sign * (bez.pts[j][k] - bound * bez.pts[j][3]);
+                }
+                double s0, s1;
+                if(!cci_hull_nonneg_range(bez.degree, c, s0, s1)) {
+                    hi = -1.0;
+                    break;
+                }
+                lo = std::max(lo, s0);
+                hi = std::min(hi, s1);
+            }
+        }
+        if(lo <= hi) {
+            double len = bez.t1 - bez.t0;
+            cci_append_clip_range(ranges, bez.t0 + lo * len, bez.t0 + hi * len);
+        }
+    }
+    return true;
+}
+
+bool cci_clip_to_box(curve const& cur, SPAbox const& box, double tol, std::vector<SPAinterval>& ranges) {
+    ranges.clear();
+    if(!box.x_range().finite() || !box.y_range().finite() || !box.z_range().finite()) {
+        return false;
+    }
+    SPAbox region = enlarge_box(box, tol);
+    switch(cur.type()) {
+        case straight_type: {
+            straight const& st = static_cast<straight const&>(cur);
+            SPAinterval clipped;
+            if(cci_clip_line_to_box(st.root_point, st.direction * st.param_scale, st.param_range(), region, clipped)) {
+                ranges.push_back(clipped);
+            }
+            return true;
+        }
+        case ellipse_type:
+            cci_clip_ellipse_to_box(static_cast<ellipse const&>(cur), region, ranges);
+            return true;
+        case helix_type: {
+            CciHelixEnvelope envelope;
+            std::vector<SPAinterval> turns;
+            if(!cci_helix_envelope(static_cast<helix const&>(cur), envelope)) {
+                return false;
+            }
+            envelope.localize(region, tol, turns);
+            for(auto const& turn: turns) {
+                cci_append_clip_range(ranges, turn.start_pt(), turn.end_pt());
+            }
+            return true;
+        }
+        case intcurve_type:
+            return cci_clip_intcurve_to_box(static_cast<intcurve const&>(cur), region, ranges);
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief 直线与直线求交(解析法)
+ * @note 重合段无界时(两条直线在同一方向上都无界)用box限定重合段；box为空时无法构造有界的重合段，返回nullptr
+ */
+curve_curve_int* straight_straight_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    straight const& st1 = static_cast<straight const&>(c1);
+    straight const& st2 = static_cast<straight const&>(c2);
+    SPAvector d1 = st1.direction * st1.param_scale;
+    SPAvector d2 = st2.direction * st2.param_scale;
+    SPAvector w = st2.root_point - st1.root_point;
+    SPAvector cr = d1 * d2;
+    double cr_sq = cr.len_sq();
+    if(cr_sq <= SPAresnor * SPAresnor * d1.len_sq() * d2.len_sq()) {
+        // 平行: 判断是否重合
+        if((w * st1.direction).len() > tol) {
+            return nullptr;
+        }
+        // 将st2的参数范围映射到st1上，与st1的参数范围取交，st2的参数t对应st1的参数t0 + s * t
+        double t0 = (w % d1) / d1.len_sq();
+        double s = (d2 % d1) / d1.len_sq();
+        SPAinterval range1 = st1.param_range();
+        SPAinterval range2 = st2.param_range();
+        double ends[2] = {range2.bounded_below() ? t0 + s * range2.start_pt() : (s > 0 ? -DBL_MAX : DBL_MAX), range2.bounded_above() ? t0 + s * range2.end_pt() : (s > 0 ? DBL_MAX : -DBL_MAX)};
+        double lo = D3_min(ends[0], ends[1]);
+        double hi = D3_max(ends[0], ends[1]);
+        if(range1.bounded_below()) {
+            lo = D3_max(lo, range1.start_pt());
+        }
+        if(range1.bounded_above()) {
+            hi = D3_min(hi, range1.end_pt());
+        }
+        if(lo > hi) {
+            return nullptr;
+        }
+        if(!(lo > -DBL_MAX) || !(hi < DBL_MAX)) {
+            // 重合段无界: 取其在包围盒内的部分
+            SPAinterval in_box;
+            if(!&box || !cci_clip_line_to_box(st1.root_point, d1, range1, enlarge_box(box, tol), in_box)) {
+                return nullptr;
+            }
+            lo = D3_max(lo, in_box.start_pt());
+            hi = D3_min(hi, in_box.end_pt());
+            if(lo > hi) {
+                return nullptr;
+            }
+        }
+        return construct_coin_inters(c1, c2, std::vector<SPAinterval>{SPAinterval(lo, hi)}, std::vector<std::pair<double, double>>{{(lo - t0) / s, (hi - t0) / s}});
+    }
+    double t1 = ((w * d2) % cr) / cr_sq;
+    double t2 = ((w * d1) % cr) / cr_sq;
+    SPAposition p1 = st1.eval_position(t1);
+    SPAposition p2 = st2.eval_position(t2);
+    if(distance_to_point(p1, p2) > tol) {
+        return nullptr;
+    }
+    curve_curve_int* inters = cci_new_inter(nullptr, mid_point(p1, p2), t1, t2);
+    inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_normal;
+    return inters;
+}
+
+/**
+ * @brief 直线与椭圆求交(解析法): 直线与椭圆共面时求解二次方程，否则求直线与椭圆所在平面的交点
+ */
+curve_curve_int* straight_ellipse_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    straight const& st = static_cast<straight const&>(c1);
+    ellipse const& ell = static_cast<ellipse const&>(c2);
+    SPAvector d = st.direction * st.param_scale;
+    SPAvector w = st.root_point - ell.centre;
+    double d_n = d % ell.normal;
+    double w_n = w % ell.normal;
+
+    std::vector<std::pair<double, logical>> params;  // (直线参数, 是否相切)
+    if(fabs(d_n) <= SPAresnor * d.len()) {
+        // 直线与椭圆所在平面平行
+        if(fabs(w_n) > tol) {
+            return nullptr;
+        }
+        SPAunit_vector vx = normalise(ell.major_axis);
+        SPAunit_vector vy = normalise(ell.normal * vx);
+        double a = ell.major_axis.len();
+        double b = a * ell.radius_ratio;
+        double x0 = (w % vx) / a, x1 = (d % vx) / a;
+        double y0 = (w % vy) / b, y1 = (d % vy) / b;
+        double qa = x1 * x1 + y1 * y1;
+        double qb = 2 * (x0 * x1 + y0 * y1);
+        double qc = x0 * x0 + y0 * y0 - 1;
+        double disc = qb * qb - 4 * qa * qc;
+        double t_mid = -qb / (2 * qa);
+        if(disc < 0) {
+            if(ell.test_point_tol(st.eval_position(t_mid), tol)) {
+                params.push_back(std::make_pair(t_mid, TRUE));
+            }
+        } else {
+            double sq = sqrt(disc) / (2 * qa);
+            if(distance_to_point(st.eval_position(t_mid - sq), st.eval_position(t_mid + sq)) <= tol) {
+                params.push_back(std::make_pair(t_mid, TRUE));
+            } else {
+                params.push_back(std::make_pair(t_mid - sq, FALSE));
+                params.push_back(std::make_pair(t_mid + sq, FALSE));
+            }
+        }
+    } else {
+        double t = -w_n / d_n;
+        if(ell.test_point_tol(st.eval_position(t), tol)) {
+            params.push_back(std::make_pair(t, FALSE));
+        }
+    }
+
+    curve_curve_int *head, *end;
+    head = end = ZeroInter;
+    for(auto const& [t, tangent]: params) {
+        SPAposition int_point = st.eval_position(t);
+        end->next = cci_new_inter(nullptr, int_point, t, refine_param(ell.param(int_point), SPAresabs));
+        end->next->low_rel = end->next->high_rel = tangent ? curve_curve_rel::cur_cur_tangent : curve_curve_rel::cur_cur_normal;
+        end = end->next;
+    }
+    end->next = nullptr;
+    curve_curve_int* inters = head->next;
+    cci_delete_inter(head);
+    return inters;
+}
+
+/**
+ * @brief 直线与螺旋线求交: 直线位于螺旋线所在圆柱面上时使用解析法，否则使用螺旋线求交引擎逐圈求交
+ */
+curve_curve_int* straight_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    straight const& st = static_cast<straight const&>(c1);
+    helix const& hel = static_cast<helix const&>(c2);
+    if(fabs(hel.taper()) <= SPAresabs && biparallel(st.direction, hel.axis_dir())) {
+        SPAvector w = st.root_point - hel.axis_root();
+        double dis_to_axis = (w - (w % hel.axis_dir()) * hel.axis_dir()).len();
+        if(fabs(dis_to_axis - hel.radius()) <= tol) {
+            curve_curve_int* inters = coin_line_helix_int(st, hel);
+            for(curve_curve_int* tmp = inters; tmp; tmp = tmp->next) {
+                tmp->param1 = st.param(tmp->int_point);
+                tmp->param2 = hel.param(tmp->int_point);
+            }
+            return sort_inters(inters);
+        }
+    }
+    return cci_helix_engine_int(c1, hel, box, tol);
+}
+
+/**
+ * @brief 直线与intcurve求交
+ */
+curve_curve_int* straight_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    return general_int_cur_cur(c1, c2, box, tol);
+}
+
+/**
+ * @brief 椭圆与椭圆求交(解析法): 共面重合时构造重合段，共面时求解结式四次方程，不共面时转化为平面交线与椭圆求交
+ */
+curve_curve_int* ellipse_ellipse_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    ellipse const& ell1 = static_cast<ellipse const&>(c1);
+    ellipse const& ell2 = static_cast<ellipse const&>(c2);
+    logical parallel_planes = biparallel(ell1.normal, ell2.normal);
+    if(!parallel_planes) {
+        return noncoplanar_ellipse_ellipse_int(ell1, ell2, box, tol);
+    }
+    if(fabs((ell2.centre - ell1.centre) % ell1.normal) > tol) {
+        return nullptr;  // 平行且不共面
+    }
+    if(ellipse_ellipse_coin_detect(ell1, ell2)) {
+        return ellipse_ellipse_coin(ell1, ell2, box, tol);
+    }
+    return coplanar_ellipse_ellipse_int(ell1, ell2, tol);
+}
+
+/**
+ * @brief 椭圆与螺旋线求交: 共面的平面螺旋线使用解方程法，否则使用螺旋线求交引擎逐圈求交
+ */
+curve_curve_int* ellipse_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    ellipse const& ell = static_cast<ellipse const&>(c1);
+    helix const& hel = static_cast<helix const&>(c2);
+    logical planar_helix = fabs(hel.pitch()) <= SPAresabs;
+    if(planar_helix && biparallel(ell.normal, hel.axis_dir()) && fabs((hel.axis_root() - ell.centre) % ell.normal) <= tol) {
+        return coplanar_ellipse_planar_helix_int(ell, hel);
+    }
+    return cci_helix_engine_int(c1, hel, box, tol);
+}
+
+/**
+ * @brief 椭圆与intcurve求交: 非有理样条使用隐式化方法，否则使用通用求交
+ */
+curve_curve_int* ellipse_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    ellipse const& ell = static_cast<ellipse const&>(c1);
+    intcurve const& ic = static_cast<intcurve const&>(c2);
+    bool owned = false;
+    bs3_curve bs3 = cci_prepared_bs3(ic, owned);
+    curve_curve_int* inters = nullptr;
+    if(bs3 && !bs3_curve_rational(bs3) && bs3_curve_degree(bs3) <= 3) {
+        inters = ellipse_bspline_int_implicitization(ell, bs3, tol);
+        inters = connect_curve_curve_int(inters, judge_curve_ends(c1, c2));
+        CurvCurvIntPointReduce(inters);
+    } else {
+        inters = general_int_cur_cur(c1, c2, box, tol);
+    }
+    if(owned) {
+        bs3_curve_delete(bs3);
+    }
+    return inters;
+}
+
+/**
+ * @brief 螺旋线与螺旋线求交: 使用螺旋线求交引擎逐圈求交
+ */
+curve_curve_int* helix_helix_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    return cci_helix_engine_int(c1, static_cast<helix const&>(c2), box, tol);
+}
+
+/**
+ * @brief 螺旋线与intcurve求交: 共面的平面螺旋线使用MAF迭代法，否则使用螺旋线求交引擎逐圈求交
+ */
+curve_curve_int* helix_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    helix const& hel = static_cast<helix const&>(c1);
+    intcurve const& ic = static_cast<intcurve const&>(c2);
+    if(fabs(hel.pitch()) <= SPAresabs) {
+        SPAposition center;
+        SPAunit_vector normal;
+        SPAinterval range = ic.param_range();
+        CciPreparedData const* data = cci_prepared_data(ic);
+        int planar = 0;
+        if(data) {
+            planar = data->planar;
+            center = data->plane_center;
+            normal = data->plane_normal;
+        } else {
+            planar = bs3_curve_is_planar(ic.cur(), ic.reversed() ? -range : range, center, normal);
+        }
+        if(planar == 1 && biparallel(normal, hel.axis_dir()) && fabs((center - hel.axis_root()) % normal) <= tol) {
+            return maf_coplnar_helix_bs3_int(hel, ic, ic.reversed() ? -range : range);
+        }
+    }
+    return swap_param(cci_helix_engine_int(c2, hel, box, tol));
+}
+
+/**
+ * @brief intcurve与intcurve求交: 先检测重合段，再对重合段外的部分做Bezier裁剪求交，未收敛的近似交点由MAF求精
+ */
+curve_curve_int* intcurve_intcurve_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    bool owned1 = false, owned2 = false;
+    bs3_curve bs1 = cci_prepared_bs3(static_cast<intcurve const&>(c1), owned1);
+    bs3_curve bs2 = cci_prepared_bs3(static_cast<intcurve const&>(c2), owned2);
+    auto release_bs3 = [&]() {
+        if(owned1) {
+            bs3_curve_delete(bs1);
+        }
+        if(owned2) {
+            bs3_curve_delete(bs2);
+        }
+    };
+    if(!bs1 || !bs2) {
+        release_bs3();
+        return nullptr;
+    }
+    // 已预处理的曲线直接使用缓存的Bezier曲线段
+    CciPreparedData const* data1 = cci_prepared_data(c1);
+    CciPreparedData const* data2 = cci_prepared_data(c2);
+    std::vector<CciBezier> const* beziers1 = data1 && data1->beziers_valid ? &data1->beziers : nullptr;
+    std::vector<CciBezier> const* beziers2 = data2 && data2->beziers_valid ? &data2->beziers : nullptr;
+    std::vector<SPAbox> const* boxes1 = beziers1 ? &data1->bezier_boxes : nullptr;
+    std::vector<SPAbox> const* boxes2 = beziers2 ? &data2->bezier_boxes : nullptr;
+
+    curve_curve_int* coins = nullptr;
+    std::vector<SPAinterval> coin_ints1, coin_ints2;
+    // 只判断是否存在交点时先不构造重合段，找不到孤立交点时再检测重合段
+    bool existence = cci_existence_query();
+    if(!existence) {
+        detect_coincident(bs1, bs2, coins, coin_ints1, coin_ints2, tol, beziers1, beziers2);
+    }
+
+    curve_curve_int* inters = nullptr;
+    std::vector<SPAinterval> left_ints1;
+    interval_exclude(bs3_curve_range(bs1), coin_ints1, left_ints1);
+    for(auto const& left_int: left_ints1) {
+        // 无重合段时sub1与bs1一致，可使用bs1缓存的Bezier曲线段
+        bool whole = left_int == bs3_curve_range(bs1);
+        bs3_curve sub1 = bs3_curve_split_interval(bs1, left_int.start_pt(), left_int.end_pt());
+        curve_curve_int *clipped = nullptr, *seeds = nullptr;
+        bezier_clip_nurbs_inters(sub1, bs2, tol, clipped, seeds, whole ? beziers1 : nullptr, beziers2, whole ? boxes1 : nullptr, boxes2);
+        if(seeds) {
+            curve_curve_int* refined = nullptr;
+            curve_curve_maf(c1, c2, seeds, refined, 300);
+            cci_delete_inters(seeds);
+            clipped = connect_curve_curve_int(clipped, refined);
+        }
+        inters = connect_curve_curve_int(inters, clipped);
+        bs3_curve_delete(sub1);
+    }
+    if(existence && !cci_existence_found(c1, c2, inters)) {
+        detect_coincident(bs1, bs2, coins, coin_ints1, coin_ints2, tol, beziers1, beziers2);
+    }
+    CurvCurvIntPointReduce(inters);
+    inters = delete_coin(inters, coin_ints1);
+
+    release_bs3();
+    return connect_curve_curve_int(coins, inters);
+}
+
+/**
+ * @brief 获得曲线在线线求交分派表中的类别
+ */
+CciCurveKind cci_curve_kind(curve const& c) {
+    switch(c.type()) {
+        case straight_type:
+            return CciCurveKind::Straight;
+        case ellipse_type:
+            return CciCurveKind::Ellipse;
+        case helix_type:
+            return CciCurveKind::Helix;
+        case intcurve_type:
+            return CciCurveKind::Intcurve;
+        default:
+            return CciCurveKind::Unknown;
+    }
+}
+
+// 线线求交分派表 CCI_KERNEL_TABLE[kind1][kind2]
+// 上三角(含对角线)为专用求交核，下三角交换两条曲线后调用对应的专用求交核，再用swap_param交换参数
+constexpr CciKernelType CCI_KERNEL_TABLE[CCI_CURVE_KIND_NUM][CCI_CURVE_KIND_NUM] = {
+  {straight_straight_int,                     straight_ellipse_int,                     straight_helix_int,                     straight_intcurve_int},
+  {cci_swapped_kernel<straight_ellipse_int>,  ellipse_ellipse_int,                      ellipse_helix_int,                      ellipse_intcurve_int },
+  {cci_swapped_kernel<straight_helix_int>,    cci_swapped_kernel<ellipse_helix_int>,    helix_helix_int,                        helix_intcurve_int   },
+  {cci_swapped_kernel<straight_intcurve_int>, cci_swapped_kernel<ellipse_intcurve_int>, cci_swapped_kernel<helix_intcurve_int>, intcurve_intcurve_int},
+};
+
+/**
+ * @brief 根据两条曲线的类别查表获得求交核，表外的曲线类别使用通用求交
+ */
+CciKernelType cci_select_kernel(curve const& c1, curve const& c2) {
+    CciCurveKind kind1 = cci_curve_kind(c1);
+    CciCurveKind kind2 = cci_curve_kind(c2);
+    if(kind1 == CciCurveKind::Unknown || kind2 == CciCurveKind::Unknown) {
+        return general_int_cur_cur;
+    }
+    return CCI_KERNEL_TABLE[static_cast<int>(kind1)][static_cast<int>(kind2)];
+}
+
+CciPreparedData::~CciPreparedData() {
+    bs3_curve_delete(bs3);
+}
+
+CciPreparedCurve::CciPreparedCurve(curve const& cur): cur(cur) {}
+
+/**
+ * @brief 派生数据是否仍对应曲线cur: 参数范围一致，intcurve的样条曲线指针和方向也一致
+ */
+static bool cci_prepared_matches(CciPreparedData const& data, curve const& cur) {
+    if(cur.param_range() != data.range) {
+        return false;
+    }
+    if(cur.type() == intcurve_type) {
+        intcurve const& ic = static_cast<intcurve const&>(cur);
+        return ic.cur() == data.source && ic.reversed() == data.reversed;
+    }
+    return true;
+}
+
+std::shared_ptr<CciPreparedData const> CciPreparedCurve::data() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(!cached || !cci_prepared_matches(*cached, cur)) {
+        cached = cci_prepare_curve(cur);
+    }
+    return cached;
+}
+
+void CciPreparedCurve::invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cached.reset();
+}
+
+// 当前线程正在使用的预处理曲线，由CciPreparedScope设置
+static thread_local CciPreparedScope* cci_current_prepared = nullptr;
+
+CciPreparedScope::CciPreparedScope(CciPreparedCurve const& c1, CciPreparedCurve const& c2): curves{&c1.get_curve(), &c2.get_curve()}, data{c1.data(), c2.data()}, previous(cci_current_prepared) {
+    cci_current_prepared = this;
+}
+
+CciPreparedScope::CciPreparedScope(curve const& c1, std::shared_ptr<CciPreparedData const> data1, curve const& c2, std::shared_ptr<CciPreparedData const> data2): curves{&c1, &c2}, data{std::move(data1), std::move(data2)}, previous(cci_current_prepared) {
+    cci_current_prepared = this;
+}
+
+CciPreparedScope::~CciPreparedScope() {
+    cci_current_prepared = previous;
+}
+
+std::shared_ptr<CciPreparedData const> cci_prepare_curve(curve const& cur) {
+    auto data = std::make_shared<CciPreparedData>();
+    data->kind = cci_curve_kind(cur);
+    data->box = bound_of_curve(cur);
+    data->range = cur.param_range();
+    if(cur.type() == intcurve_type) {
+        intcurve const& ic = static_cast<intcurve const&>(cur);
+        data->source = ic.cur();
+        data->reversed = ic.reversed();
+        data->bs3 = cci_intcurve_bs3(ic);
+        if(data->bs3) {
+            data->degree = bs3_curve_degree(data->bs3);
+            data->rational = bs3_curve_rational(data->bs3);
+            data->beziers_valid = cci_nurbs_to_beziers(data->bs3, data->beziers);
+            for(auto const& bez: data->beziers) {
+                data->bezier_boxes.push_back(cci_bezier_box(bez));
+            }
+        }
+        SPAinterval range = ic.param_range();
+        data->planar = bs3_curve_is_planar(ic.cur(), ic.reversed() ? -range : range, data->plane_center, data->plane_normal);
+        data->linear = SPL_BezcHeightEstimate(ic.cur()) <= SPAresabs;
+    } else if(cur.type() == helix_type) {
+        data->helix_valid = data->envelope.init(static_cast<helix const&>(cur));
+    }
+    return data;
+}
+
+std::shared_ptr<CciPreparedData const> cci_prepare_subset(CciPreparedData const& parent, curve const& sub) {
+    auto data = std::make_shared<CciPreparedData>();
+    data->kind = parent.kind;
+    data->box = bound_of_curve(sub);
+    data->range = sub.param_range();
+    double a = data->range.start_pt(), b = data->range.end_pt();
+    if(sub.type() == intcurve_type && parent.bs3) {
+        intcurve const& ic = static_cast<intcurve const&>(sub);
+        data->source = ic.cur();
+        data->reversed = ic.reversed();
+        // parent.bs3的参数化与整条曲线一致，子曲线的样条曲线直接从中截取
+        data->bs3 = bs3_curve_split_interval(parent.bs3, a, b);
+        data->degree = parent.degree;
+        data->rational = parent.rational;
+        if(parent.beziers_valid) {
+            for(size_t i = 0; i < parent.beziers.size(); ++i) {
+                CciBezier bez = parent.beziers[i];
+                if(bez.t1 <= a + SPAresnor || bez.t0 >= b - SPAresnor) {
+                    continue;
+                }
+                bool trimmed = false;
+                CciBezier left, right;
+                if(bez.t0 < a - SPAresnor) {
+                    cci_bezier_split(bez, (a - bez.t0) / (bez.t1 - bez.t0), left, right);
+                    bez = right;
+                    trimmed = true;
+                }
+                if(bez.t1 > b + SPAresnor) {
+                    cci_bezier_split(bez, (b - bez.t0) / (bez.t1 - bez.t0), left, right);
+                    bez = left;
+                    trimmed = true;
+                }
+                data->beziers.push_back(bez);
+                data->bezier_boxes.push_back(trimmed ? cci_bezier_box(bez) : parent.bezier_boxes[i]);
+            }
+            data->beziers_valid = !data->beziers.empty();
+            if(data->beziers_valid) {
+                data->beziers.front().t0 = a;
+                data->beziers.back().t1 = b;
+            }
+        }
+        // 平面曲线的子曲线仍在同一平面上；直线性按整条样条曲线判断，与未预处理时一致
+        if(parent.planar == 1) {
+            data->planar = parent.planar;
+            data->plane_center = parent.plane_center;
+            data->plane_normal = parent.plane_normal;
+        } else {
+            data->planar = bs3_curve_is_planar(ic.cur(), ic.reversed() ? -data->range : data->range, data->plane_center, data->plane_normal);
+        }
+        data->linear = parent.linear;
+    } else if(sub.type() == helix_type) {
+        data->helix_valid = parent.helix_valid;
+        data->envelope = parent.envelope;
+        data->envelope.range = data->range;
+    }
+    return data;
+}
+
+CciPreparedData const* cci_prepared_data(curve const& cur) {
+    if(cci_current_prepared) {
+        for(int i = 0; i < 2; ++i) {
+            if(cci_current_prepared->curves[i] == &cur) {
+                return cci_current_prepared->data[i].get();
+            }
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief 获得当前线程CciPreparedScope中曲线cur的派生数据的共享指针
+ * @return cur未预处理时返回nullptr
+ */
+static std::shared_ptr<CciPreparedData const> cci_prepared_shared(curve const& cur) {
+    if(cci_current_prepared) {
+        for(int i = 0; i < 2; ++i) {
+            if(cci_current_prepared->curves[i] == &cur) {
+                return cci_current_prepared->data[i];
+            }
+        }
+    }
     return nullptr;
 }
+
+bs3_curve cci_prepared_bs3(intcurve const& ic, bool& owned) {
+    CciPreparedData const* data = cci_prepared_data(ic);
+    owned = data == nullptr;
+    return data ? data->bs3 : cci_intcurve_bs3(ic);
+}
+
+curve_curve_int* answer_int_cur_cur(CciPreparedCurve const& c1, CciPreparedCurve const& c2, SPAbox const& box, double tol) {
+    CciPreparedScope prepared_scope(c1, c2);
+    return answer_int_cur_cur(c1.get_curve(), c2.get_curve(), box, tol);
+}
+
+/**
+ * @brief 包围盒裁剪前端: 先将两条曲线的参数范围裁剪为包围盒内的子区间，只对包围盒相交的子区间对调用求交核，
+ *        并删除子区间参数范围外的交点；包围盒为空或两条曲线都不支持裁剪时对整条曲线求交。
+ *        预处理曲线的子曲线使用由整条曲线的派生数据得到的派生数据(见cci_prepare_subset)；
+ *        子区间对有重合段时重合段会在子区间端点处被截断，此时改为对整条曲线求交，保持重合段完整，
+ *        其中无界曲线取其包围盒内子区间的并
+ * @return 已经过filter_normal_inters的求交结果
+ */
+static curve_curve_int* cci_clipped_kernel_int(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    CciKernelType kernel = cci_select_kernel(c1, c2);
+    std::vector<SPAinterval> ranges1, ranges2;
+    bool clipped1 = &box && cci_clip_to_box(c1, box, tol, ranges1);
+    bool clipped2 = &box && cci_clip_to_box(c2, box, tol, ranges2);
+    if(!clipped1 && !clipped2) {
+        return filter_normal_inters(kernel(c1, c2, box, tol), c1, c2);
+    }
+    if((clipped1 && ranges1.empty()) || (clipped2 && ranges2.empty())) {
+        return nullptr;
+    }
+    // 子区间覆盖整个参数范围时直接使用原曲线，保留预处理曲线缓存
+    auto pieces = [](curve const& cur, bool clipped, std::vector<SPAinterval> const& ranges, std::vector<curve*>& subs) {
+        SPAinterval range = cur.param_range();
+        if(!clipped || (ranges.size() == 1 && range.finite() && ranges[0].start_pt() <= range.start_pt() + SPAresnor && ranges[0].end_pt() >= range.end_pt() - SPAresnor)) {
+            subs.push_back(nullptr);
+            return;
+        }
+        for(auto const& sub_range: ranges) {
+            subs.push_back(cur.subset(sub_range));
+        }
+    };
+    std::vector<curve*> subs1, subs2;
+    pieces(c1, clipped1, ranges1, subs1);
+    pieces(c2, clipped2, ranges2, subs2);
+    std::shared_ptr<CciPreparedData const> parent1 = cci_prepared_shared(c1), parent2 = cci_prepared_shared(c2);
+    std::vector<std::shared_ptr<CciPreparedData const>> datas1, datas2;
+    for(curve* sub: subs1) {
+        datas1.push_back(sub && parent1 ? cci_prepare_subset(*parent1, *sub) : parent1);
+    }
+    for(curve* sub: subs2) {
+        datas2.push_back(sub && parent2 ? cci_prepare_subset(*parent2, *sub) : parent2);
+    }
+    std::vector<SPAbox> boxes1, boxes2;
+    bool multiple = subs1.size() > 1 || subs2.size() > 1;
+    for(curve* sub: subs1) {
+        boxes1.push_back(multiple && sub ? sub->bound(sub->param_range()) : SPAbox());
+    }
+    for(curve* sub: subs2) {
+        boxes2.push_back(multiple && sub ? sub->bound(sub->param_range()) : SPAbox());
+    }
+
+    bool existence = cci_existence_query();
+    bool coincident = false;
+    curve_curve_int* inters = nullptr;
+    for(size_t i = 0; i < subs1.size(); ++i) {
+        curve const& sub1 = subs1[i] ? *subs1[i] : c1;
+        for(size_t j = 0; j < subs2.size(); ++j) {
+            curve const& sub2 = subs2[j] ? *subs2[j] : c2;
+            if(subs1[i] && subs2[j] && multiple && !(enlarge_box(boxes1[i], tol) && boxes2[j])) {
+                continue;
+            }
+            CciPreparedScope prepared_scope(sub1, datas1[i], sub2, datas2[j]);
+            curve_curve_int* pair_inters = nullptr;
+            if(existence) {
+                // 存在性查询按曲线地址判断两条曲线是否交换，需对子曲线重新设置
+                CciExistenceScope pair_scope(sub1, sub2, box);
+                pair_inters = kernel(sub1, sub2, box, tol);
+            } else {
+                pair_inters = kernel(sub1, sub2, box, tol);
+            }
+            for(curve_curve_int* inter = pair_inters; inter && !coincident; inter = inter->next) {
+                coincident = inter->low_rel == curve_curve_rel::cur_cur_coin || inter->high_rel == curve_curve_rel::cur_cur_coin;
+            }
+            inters = connect_curve_curve_int(inters, filter_normal_inters(pair_inters, sub1, sub2));
+        }
+    }
+    for(curve* sub: subs1) {
+        ACIS_DELETE sub;
+    }
+    for(curve* sub: subs2) {
+        ACIS_DELETE sub;
+    }
+    // 存在性查询只需知道有交点，不必还原完整的重合段
+    if(coincident && !existence) {
+        cci_delete_inters(inters);
+        // 有界曲线取整条曲线，保持重合段完整；无界曲线取包围盒内子区间的并，使重合段有界
+        auto hull = [](curve const& cur, bool clipped, std::vector<SPAinterval> const& ranges) -> curve* {
+            return clipped && !cur.param_range().finite() ? cur.subset(SPAinterval(ranges.front().start_pt(), ranges.back().end_pt())) : nullptr;
+        };
+        curve* hull1 = hull(c1, clipped1, ranges1);
+        curve* hull2 = hull(c2, clipped2, ranges2);
+        curve const& whole1 = hull1 ? *hull1 : c1;
+        curve const& whole2 = hull2 ? *hull2 : c2;
+        inters = filter_normal_inters(kernel(whole1, whole2, box, tol), whole1, whole2);
+        ACIS_DELETE hull1;
+        ACIS_DELETE hull2;
+    }
+    return inters;
+}
+
+bool curves_intersect(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    if(is_degenerate(c1) || is_degenerate(c2)) {
+        return false;
+    }
+    SPAbox box1, box2;
+    if(!cci_batch_box(c1, box, tol, box1) || !cci_batch_box(c2, box, tol, box2) || !(box1 && box2)) {
+        return false;
+    }
+    CCI_STAT_CALL();
+    CciInterArenaScope arena_scope;
+    CciExistenceScope existence_scope(c1, c2, box);
+    curve_curve_int* inters = cci_clipped_kernel_int(c1, c2, box, tol);
+    inters = points_in_box(inters, box);
+    bool found = inters != nullptr;
+    cci_delete_inters(inters);
+    return found;
+}
+
+curve_curve_int* first_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    if(is_degenerate(c1) || is_degenerate(c2)) {
+        return nullptr;
+    }
+    SPAbox box1, box2;
+    if(!cci_batch_box(c1, box, tol, box1) || !cci_batch_box(c2, box, tol, box2) || !(box1 && box2)) {
+        return nullptr;
+    }
+    CCI_STAT_CALL();
+    CciInterArenaScope arena_scope;
+    curve_curve_int* inters = cci_clipped_kernel_int(c1, c2, box, tol);
+
+    // 第一个交点可能是重合段的起点，因此仍需完整求交，但只对param1最小的交点计算交点关系
+    inters = points_in_box(inters, box);
+    curve_curve_int* first = inters;
+    for(curve_curve_int* cur = inters; cur; cur = cur->next) {
+        if(cur->param1 < first->param1) {
+            first = cur;
+        }
+    }
+    for(curve_curve_int* cur = inters; cur;) {
+        curve_curve_int* next = cur->next;
+        if(cur != first) {
+            cci_delete_inter(cur);
+        }
+        cur = next;
+    }
+    if(first) {
+        first->next = nullptr;
+        compute_normal_rel(first, c1, c2);
+    }
+    return arena_scope.arena.materialize(first);
+}
+
+void CciBvh::build(std::vector<SPAbox> const& boxes, std::vector<int> const& ids) {
+    nodes.clear();
+    indices = ids;
+    item_boxes.clear();
+    if(ids.empty()) {
+        return;
+    }
+    std::vector<SPAposition> centers(boxes.size());
+    for(int id: ids) {
+        centers[id] = boxes[id].mid();
+    }
+    nodes.reserve(2 * ids.size() / LEAF_SIZE + 1);
+    build_node(boxes, centers, 0, static_cast<int>(ids.size()));
+    item_boxes.resize(indices.size());
+    for(size_t k = 0; k < indices.size(); ++k) {
+        item_boxes[k] = boxes[indices[k]];
+    }
+}
+
+int CciBvh::build_node(std::vector<SPAbox> const& boxes, std::vector<SPAposition> const& centers, int first, int count) {
+    int node_id = static_cast<int>(nodes.size());
+    nodes.emplace_back();
+    SPAbox bound = boxes[indices[first]];
+    SPAbox center_bound(centers[indices[first]]);
+    for(int k = first + 1; k < first + count; ++k) {
+        bound |= boxes[indices[k]];
+        center_bound |= SPAbox(centers[indices[k]]);
+    }
+    nodes[node_id].box = bound;
+    nodes[node_id].first = first;
+    nodes[node_id].count = count;
+
+    // 沿包围盒中心分布最广的轴二分，所有中心重合时不再二分
+    SPAvector extent = center_bound.high() - center_bound.low();
+    int axis = 0;
+    for(int k = 1; k < 3; ++k) {
+        if(extent.component(k) > extent.component(axis)) {
+            axis = k;
+        }
+    }
+    if(count <= LEAF_SIZE || extent.component(axis) <= 0.0) {
+        return node_id;
+    }
+    int mid = first + count / 2;
+    std::nth_element(indices.begin() + first, indices.begin() + mid, indices.begin() + first + count, [&centers, axis](int a, int b) { return centers[a].coordinate(axis) < centers[b].coordinate(axis); });
+    int left = build_node(boxes, centers, first, mid - first);
+    int right = build_node(boxes, centers, mid, first + count - mid);
+    nodes[node_id].left = left;
+    nodes[node_id].right = right;
+    nodes[node_id].count = 0;
+    return node_id;
+}
+
+bool cci_batch_box(curve const& cur, SPAbox const& box, double tol, SPAbox& cur_box) {
+    cur_box = enlarge_box(bound_of_curve(cur), tol);
+    if(&box) {
+        if(!(cur_box && box)) {
+            return false;
+        }
+        cur_box = cur_box & box;
+    }
+    return true;
+}
+
+std::vector<CciBatchResult> cci_batch_int(std::vector<curve const*> const& curves1, std::vector<curve const*> const& curves2, bool self, SPAbox const& box, double tol) {
+    CCI_STAT_CALL();  // 整个批量求交记为一次调用
+    // 第二组曲线: 有界包围盒建立BVH，无界包围盒的曲线与所有曲线检查
+    std::vector<SPAbox> boxes2(curves2.size());
+    std::vector<bool> inside2(curves2.size(), false);
+    std::vector<int> bounded2, unbounded2;
+    for(int j = 0; j < curves2.size(); ++j) {
+        if(curves2[j] && cci_batch_box(*curves2[j], box, tol, boxes2[j])) {
+            inside2[j] = true;
+            (boxes2[j].finite() ? bounded2 : unbounded2).push_back(j);
+        }
+    }
+    CciBvh bvh;
+    bvh.build(boxes2, bounded2);
+
+    // 预处理曲线只在首次参与窄相求交时构造，自交检查时两组共用
+    std::vector<std::unique_ptr<CciPreparedCurve>> prepared2(curves2.size());
+    std::vector<std::unique_ptr<CciPreparedCurve>> prepared1_own(self ? 0 : curves1.size());
+    std::vector<std::unique_ptr<CciPreparedCurve>>& prepared1 = self ? prepared2 : prepared1_own;
+    auto prepare = [](std::vector<std::unique_ptr<CciPreparedCurve>>& prepared, curve const* cur, int k) -> CciPreparedCurve const& {
+        if(!prepared[k]) {
+            prepared[k] = std::make_unique<CciPreparedCurve>(*cur);
+        }
+        return *prepared[k];
+    };
+
+    std::vector<CciBatchResult> results;
+    std::vector<int> candidates;
+    for(int i = 0; i < curves1.size(); ++i) {
+        SPAbox box1;
+        if(!curves1[i] || !cci_batch_box(*curves1[i], box, tol, box1)) {
+            continue;
+        }
+        candidates.clear();
+        if(box1.finite()) {
+            bvh.query(box1, [&candidates](int j) { candidates.push_back(j); });
+            candidates.insert(candidates.end(), unbounded2.begin(), unbounded2.end());
+        } else {
+            for(int j = 0; j < curves2.size(); ++j) {
+                if(inside2[j]) {
+                    candidates.push_back(j);
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        for(int j: candidates) {
+            if(self && j <= i) {
+                continue;
+            }
+            curve const& c1 = *curves1[i];
+            curve const& c2 = *curves2[j];
+            curve_curve_int* inters = nullptr;
+            if(c1.type() == intcurve_type || c2.type() == intcurve_type) {
+                // 样条曲线的预处理数据在多次求交中复用
+                inters = answer_int_cur_cur(prepare(prepared1, &c1, i), prepare(prepared2, &c2, j), box, tol);
+            } else {
+                inters = answer_int_cur_cur(c1, c2, box, tol);
+            }
+            if(inters) {
+                results.push_back({i, j, inters});
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<CciBatchResult> answer_int_cur_cur_batch(std::vector<curve const*> const& curves1, std::vector<curve const*> const& curves2, SPAbox const& box, double tol) {
+    return cci_batch_int(curves1, curves2, false, box, tol);
+}
+
+std::vector<CciBatchResult> answer_int_cur_cur_batch(std::vector<curve const*> const& curves, SPAbox const& box, double tol) {
+    return cci_batch_int(curves, curves, true, box, tol);
+}
+
+curve_curve_int* answer_int_cur_cur(curve const& c1, curve const& c2, SPAbox const& box, double tol) {
+    if(is_degenerate(c1) || is_degenerate(c2)) {
+        return nullptr;
+    }
+    CCI_STAT_CALL();
+    CciRecordScope record_scope(c1, c2, box, tol);
+    // 求交过程中的中间结点均从内存池分配，只有最终结果转换为ACIS_NEW分配的结点
+    CciInterArenaScope arena_scope;
+    // 先将参数范围裁剪到包围盒内再求交，求交核不在包围盒外做无用功
+    curve_curve_int* inters = cci_clipped_kernel_int(c1, c2, box, tol);
+
+    // 删除包围盒外的交点，按照param1升序输出
+    inters = points_in_box(inters, box);
+    compute_normal_rel(inters, c1, c2);
+    inters = arena_scope.arena.materialize(sort_inters(inters));
+    record_scope.finish(inters);
+    return inters;
+}
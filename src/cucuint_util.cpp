@@ -1,13 +1,34 @@
 ﻿#include "cucuint_util.hxx"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <format>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "acis/acistol.hxx"
 #include "acis/bs3ccont.hxx"
 #include "acis/ckoutcom.hxx"
@@ -29,6 +50,7 @@
 #include "acis/law.hxx"
 #include "acis/math.hxx"
 #include "acis/matrix.hxx"
+#include "acis/model_state.hxx"
 #include "acis/par_int.hxx"
 #include "acis/param.hxx"
 #include "acis/pcudef.hxx"
@@ -38,6 +60,7 @@
 #include "acis/sps2crtn.hxx"
 #include "acis/sps3crtn.hxx"
 #include "acis/strdef.hxx"
+#include "acis/thmgr.hxx"
 #include "acis/tordef.hxx"
 #include "acis/vec.hxx"
 #include "acis/vector_utils.hxx"
@@ -51,6 +74,203 @@
  * 6.bound 耗时过长暂不解耦
  */
 
+// 当前线程正在使用的交点结点内存池，由CciInterArenaScope设置
+static thread_local CciInterArena* cci_current_arena = nullptr;
+
+CciInterArena::~CciInterArena() {
+    for(auto& block: blocks) {
+        for(int i = 0; i < BLOCK_SIZE; ++i) {
+            if(block[i].live) {
+                reinterpret_cast<curve_curve_int*>(block[i].storage)->~curve_curve_int();
+            }
+        }
+    }
+}
+
+void CciInterArena::BlockDeleter::operator()(Slot* block) const {
+    ::operator delete(block, std::align_val_t(BLOCK_BYTES));
+}
+
+curve_curve_int* CciInterArena::make(curve_curve_int* next, SPAposition const& pt, double param1, double param2) {
+    if(free_list == nullptr) {
+        Slot* block = static_cast<Slot*>(::operator new(BLOCK_BYTES, std::align_val_t(BLOCK_BYTES)));
+        blocks.emplace_back(block);
+        block_addrs.insert(reinterpret_cast<std::uintptr_t>(block));
+        for(int i = BLOCK_SIZE - 1; i >= 0; --i) {
+            ::new(static_cast<void*>(&block[i])) Slot;
+            block[i].live = false;
+            block[i].next_free = free_list;
+            free_list = &block[i];
+        }
+    }
+    Slot* slot = free_list;
+    free_list = slot->next_free;
+    curve_curve_int* inter = ::new(static_cast<void*>(slot->storage)) curve_curve_int(next, pt, param1, param2);
+    slot->live = true;
+    return inter;
+}
+
+void CciInterArena::release(curve_curve_int* inter) {
+    Slot* slot = reinterpret_cast<Slot*>(inter);
+    inter->~curve_curve_int();
+    slot->live = false;
+    slot->next_free = free_list;
+    free_list = slot;
+}
+
+bool CciInterArena::owns(curve_curve_int const* inter) const {
+    auto addr = reinterpret_cast<std::uintptr_t>(inter);
+    return block_addrs.count(addr & ~static_cast<std::uintptr_t>(BLOCK_BYTES - 1)) != 0;
+}
+
+curve_curve_int* CciInterArena::materialize(curve_curve_int* inters) {
+    curve_curve_int *head = nullptr, **link = &head;
+    while(inters) {
+        curve_curve_int* next = inters->next;
+        curve_curve_int* node = inters;
+        if(owns(inters)) {
+            node = ACIS_NEW curve_curve_int(nullptr, inters->int_point, inters->param1, inters->param2);
+            node->low_rel = inters->low_rel;
+            node->high_rel = inters->high_rel;
+            node->uv = inters->uv;
+            node->uv_set = inters->uv_set;
+            node->userdata = inters->userdata;
+            inters->userdata = nullptr;
+            release(inters);
+        }
+        *link = node;
+        link = &node->next;
+        inters = next;
+    }
+    *link = nullptr;
+    return head;
+}
+
+CciInterArenaScope::CciInterArenaScope(): previous(cci_current_arena) {
+    cci_current_arena = &arena;
+}
+
+CciInterArenaScope::~CciInterArenaScope() {
+    cci_current_arena = previous;
+}
+
+curve_curve_int* cci_new_inter(curve_curve_int* next, SPAposition const& pt, double param1, double param2) {
+    CCI_STAT_INC(nodes_allocated);
+    if(cci_current_arena) {
+        return cci_current_arena->make(next, pt, param1, param2);
+    }
+    return ACIS_NEW curve_curve_int(next, pt, param1, param2);
+}
+
+void cci_delete_inter(curve_curve_int* inter) {
+    if(inter == nullptr) {
+        return;
+    }
+    CCI_STAT_INC(nodes_freed);
+    if(cci_current_arena && cci_current_arena->owns(inter)) {
+        cci_current_arena->release(inter);
+    } else {
+        ACIS_DELETE inter;
+    }
+}
+
+void cci_delete_inters(curve_curve_int*& head) {
+    while(head) {
+        curve_curve_int* next = head->next;
+        cci_delete_inter(head);
+        head = next;
+    }
+}
+
+static thread_local CciStats cci_stats_thread;     // 当前线程的累计统计
+static thread_local CciStats cci_stats_last;       // 当前线程最近一次调用的统计
+static thread_local int cci_stats_call_depth = 0;  // 当前线程的调用嵌套层数
+static std::mutex cci_stats_process_mutex;
+static CciStats cci_stats_process_total;  // 所有线程已完成调用的汇总
+
+void CciStats::add(CciStats const& other) {
+    for(int i = 0; i < static_cast<int>(CciCounter::count); ++i) {
+        counters[i] += other.counters[i];
+    }
+    for(int i = 0; i < static_cast<int>(CciTimer::count); ++i) {
+        timer_ns[i] += other.timer_ns[i];
+        timer_calls[i] += other.timer_calls[i];
+    }
+    calls += other.calls;
+}
+
+void CciStats::subtract(CciStats const& other) {
+    for(int i = 0; i < static_cast<int>(CciCounter::count); ++i) {
+        counters[i] -= other.counters[i];
+    }
+    for(int i = 0; i < static_cast<int>(CciTimer::count); ++i) {
+        timer_ns[i] -= other.timer_ns[i];
+        timer_calls[i] -= other.timer_calls[i];
+    }
+    calls -= other.calls;
+}
+
+std::string CciStats::to_json() const {
+    static char const* counter_names[] = {"seeds", "refine_iters", "bound_calls", "invert_calls", "coin_tests", "nodes_allocated", "nodes_freed"};
+    static char const* timer_names[] = {"total", "near_inters", "bezier_clip", "refine", "detect_coincident", "point_reduce"};
+    static_assert(std::size(counter_names) == static_cast<size_t>(CciCounter::count));
+    static_assert(std::size(timer_names) == static_cast<size_t>(CciTimer::count));
+    std::string json = std::format("{{\"calls\": {}, \"counters\": {{", calls);
+    for(int i = 0; i < static_cast<int>(CciCounter::count); ++i) {
+        json += std::format("{}\"{}\": {}", i ? ", " : "", counter_names[i], counters[i]);
+    }
+    json += "}, \"timers\": {";
+    for(int i = 0; i < static_cast<int>(CciTimer::count); ++i) {
+        json += std::format("{}\"{}\": {{\"calls\": {}, \"ns\": {}}}", i ? ", " : "", timer_names[i], timer_calls[i], timer_ns[i]);
+    }
+    json += "}}";
+    return json;
+}
+
+CciStats& cci_thread_stats() {
+    return cci_stats_thread;
+}
+
+CciStats const& cci_stats_last_call() {
+    return cci_stats_last;
+}
+
+CciStats cci_stats_process() {
+    std::lock_guard<std::mutex> lock(cci_stats_process_mutex);
+    return cci_stats_process_total;
+}
+
+void cci_stats_reset() {
+    std::lock_guard<std::mutex> lock(cci_stats_process_mutex);
+    cci_stats_process_total = CciStats();
+    cci_stats_thread = CciStats();
+    cci_stats_last = CciStats();
+}
+
+CciScopedTimer::~CciScopedTimer() {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    cci_stats_thread.timer_ns[static_cast<int>(timer)] += ns;
+    cci_stats_thread.timer_calls[static_cast<int>(timer)] += 1;
+}
+
+CciStatsCallScope::CciStatsCallScope(): outermost(cci_stats_call_depth++ == 0), begin(cci_stats_thread), start(std::chrono::steady_clock::now()) {
+}
+
+CciStatsCallScope::~CciStatsCallScope() {
+    --cci_stats_call_depth;
+    if(!outermost) {
+        return;
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    cci_stats_thread.timer_ns[static_cast<int>(CciTimer::total)] += ns;
+    cci_stats_thread.timer_calls[static_cast<int>(CciTimer::total)] += 1;
+    cci_stats_thread.calls += 1;
+    cci_stats_last = cci_stats_thread;
+    cci_stats_last.subtract(begin);
+    std::lock_guard<std::mutex> lock(cci_stats_process_mutex);
+    cci_stats_process_total.add(cci_stats_last);
+}
+
 /**
  * @brief 将线线求交的单链表组织的所有交点 按照param1升序输出
  * @return 排序后的所有交点的首节点
@@ -262,7 +482,7 @@ curve_curve_int* coin_line_helix_int(straight const& cs_line, helix const& cs_he
                 if(param + i * (2 * M_PI) << param_range) {
                     param2 = param + i * (2 * M_PI);
                     int_point = cs_helix.eval_position(param2);
-                    end->next = ACIS_NEW curve_curve_int(nullptr, int_point, 0.0, 0.0);
+                    end->next = cci_new_inter(nullptr, int_point, 0.0, 0.0);
                     end->next->low_rel = end->next->high_rel = curve_curve_rel::cur_cur_unknown;
                     end = end->next;
                 }
@@ -273,7 +493,7 @@ curve_curve_int* coin_line_helix_int(straight const& cs_line, helix const& cs_he
                 if(param + i * (2 * M_PI) << param_range) {
                     param2 = param + i * (2 * M_PI);
                     int_point = cs_helix.eval_position(param2);
-                    end->next = ACIS_NEW curve_curve_int(nullptr, int_point, 0.0, 0.0);
+                    end->next = cci_new_inter(nullptr, int_point, 0.0, 0.0);
                     end->next->low_rel = end->next->high_rel = curve_curve_rel::cur_cur_unknown;
                     end = end->next;
                 }
@@ -281,11 +501,11 @@ curve_curve_int* coin_line_helix_int(straight const& cs_line, helix const& cs_he
         }
 
         // 销毁直线与圆求交的辅助交点
-        delete_curve_curve_ints(line_ell_inter);
+        cci_delete_inters(line_ell_inter);
     }
     end->next = nullptr;
     auto ret = head->next;
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     ACIS_DELETE c1;
     ACIS_DELETE c2;
     return ret;
@@ -499,37 +719,394 @@ void GetCubicPoly(double u0, double u1, double u2, double u3, double u4, double
 }
 
 /**
- * @brief 求一元n次多项式方程的所有根
+ * @brief Horner法计算多项式的值
+ * @return 多项式在x处的值
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 自变量
+ */
+double poly_eval(int degree, double const* coef, double x) {
+    double val = coef[0];
+    for(int i = 1; i <= degree; ++i) {
+        val = val * x + coef[i];
+    }
+    return val;
+}
+
+/**
+ * @brief Horner法同时计算多项式的值与一阶导数
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 自变量
+ * @param val 输出多项式在x处的值
+ * @param deriv 输出多项式在x处的一阶导数
+ */
+void poly_eval_deriv(int degree, double const* coef, double x, double& val, double& deriv) {
+    val = coef[0];
+    deriv = 0.0;
+    for(int i = 1; i <= degree; ++i) {
+        deriv = deriv * x + val;
+        val = val * x + coef[i];
+    }
+}
+
+/**
+ * @brief 牛顿迭代精化多项式的根，残差不再下降时停止
+ * @return 精化后的根
+ * @param degree 多项式的次数
+ * @param coef 多项式的系数，从次数最高的系数开始存储
+ * @param x 根的初值
+ */
+double poly_newton_polish(int degree, double const* coef, double x) {
+    double f = 0.0, df = 0.0;
+    poly_eval_deriv(degree, coef, x, f, df);
+    for(int iter = 0; iter < 8 && f != 0.0 && df != 0.0; ++iter) {
+        double next = x - f / df;
+        double next_f = 0.0, next_df = 0.0;
+        poly_eval_deriv(degree, coef, next, next_f, next_df);
+        if(!(fabs(next_f) < fabs(f))) {
+            break;
+        }
+        x = next;
+        f = next_f;
+        df = next_df;
+    }
+    return x;
+}
+
+/**
+ * @brief 数值稳定的二次方程求根 a*x^2 + b*x + c = 0，要求a不为零
+ * @return 根的个数，重根只输出一次
+ * @param roots 输出的根，至少能存放2个值
+ */
+int solve_quadratic_roots(double a, double b, double c, double* roots) {
+    double disc = b * b - 4.0 * a * c;
+    double eps = 1e-14 * (b * b + fabs(4.0 * a * c));
+    if(disc < -eps) {
+        return 0;
+    }
+    if(disc <= eps) {  // 判别式在舍入误差内为零，视为重根
+        roots[0] = -b / (2.0 * a);
+        return 1;
+    }
+    double q = -0.5 * (b + std::copysign(sqrt(disc), b));  // 避免b与sqrt(disc)相减造成的抵消误差
+    roots[0] = q / a;
+    roots[1] = c / q;
+    return 2;
+}
+
+/**
+ * @brief 三次方程求根 x^3 + a*x^2 + b*x + c = 0 (首一)，三实根时用三角形式，否则用Cardano公式
  * @return 根的个数
- * @param degree 多项式方程的最高次数
- * @param dxyCoef 存储多项式方程的系数，从次数最高的系数开始存储
- * @param root 输出所求得的根，求得的根在[start, end]范围内
+ * @param roots 输出的根，至少能存放3个值
+ */
+int solve_cubic_roots(double a, double b, double c, double* roots) {
+    double a3 = a / 3.0;
+    double Q = (a * a - 3.0 * b) / 9.0;
+    double R = (2.0 * a * a * a - 9.0 * a * b + 27.0 * c) / 54.0;
+    double R2 = R * R, Q3 = Q * Q * Q;
+    double eps = 1e-14 * (R2 + fabs(Q3));
+    if(R2 < Q3 - eps) {
+        double theta = acos(std::clamp(R / sqrt(Q3), -1.0, 1.0));
+        double sq = -2.0 * sqrt(Q);
+        roots[0] = sq * cos(theta / 3.0) - a3;
+        roots[1] = sq * cos((theta + 2.0 * M_PI) / 3.0) - a3;
+        roots[2] = sq * cos((theta - 2.0 * M_PI) / 3.0) - a3;
+        return 3;
+    }
+    double A = -std::copysign(std::cbrt(fabs(R) + sqrt(std::max(R2 - Q3, 0.0))), R);
+    double B = (A == 0.0) ? 0.0 : Q / A;
+    roots[0] = (A + B) - a3;
+    if(R2 - Q3 <= eps) {  // 判别式为零，存在重根
+        roots[1] = -0.5 * (A + B) - a3;
+        return 2;
+    }
+    return 1;
+}
+
+/**
+ * @brief Ferrari法求四次方程的根 x^4 + a*x^3 + b*x^2 + c*x + d = 0 (首一)
+ * @return 根的个数
+ * @param roots 输出的根，至少能存放4个值
+ */
+int solve_quartic_roots(double a, double b, double c, double d, double* roots) {
+    // 代换 x = y - a/4 得到缺项四次方程 y^4 + p*y^2 + q*y + r = 0
+    double a4 = a / 4.0;
+    double aa = a * a;
+    double p = b - 3.0 * aa / 8.0;
+    double q = c - a * b / 2.0 + aa * a / 8.0;
+    double r = d - a * c / 4.0 + aa * b / 16.0 - 3.0 * aa * aa / 256.0;
+    int num = 0;
+    double tmp[3];
+    // q相对为零，或预解三次方程的最大根相对为零(重根情形)时按双二次方程求解，unit为根的量级
+    double unit = std::max({fabs(a), sqrt(fabs(b)), std::cbrt(fabs(c)), sqrt(sqrt(fabs(d))), 1e-100});
+    double m = 0.0;
+    if(fabs(q) > 1e-10 * unit * unit * unit) {
+        // 预解三次方程 m^3 + p*m^2 + (p^2/4 - r)*m - q^2/8 = 0 的最大实根必为正
+        int nm = solve_cubic_roots(p, p * p / 4.0 - r, -q * q / 8.0, tmp);
+        m = tmp[0];
+        for(int i = 1; i < nm; ++i) {
+            m = std::max(m, tmp[i]);
+        }
+    }
+    if(m <= 1e-12 * unit * unit) {
+        // 双二次方程 z^2 + p*z + r = 0, y = ±sqrt(z)，p、r由代换得到，容差按根的量级取
+        double disc = p * p - 4.0 * r;
+        if(disc < -1e-12 * unit * unit * unit * unit) {
+            return 0;
+        }
+        double sq = sqrt(std::max(disc, 0.0));
+        tmp[0] = 0.5 * (-p + sq);
+        tmp[1] = 0.5 * (-p - sq);
+        for(int i = 0; i < 2; ++i) {
+            if(tmp[i] < -1e-12 * unit * unit || (i == 1 && sq == 0.0)) {
+                continue;
+            }
+            double y = sqrt(std::max(tmp[i], 0.0));
+            roots[num++] = y - a4;
+            if(y > 0.0) {
+                roots[num++] = -y - a4;
+            }
+        }
+        return num;
+    }
+    double s = sqrt(2.0 * m);
+    double half = p / 2.0 + m;
+    double qs = q / (2.0 * s);
+    double ys[4];
+    int n1 = solve_quadratic_roots(1.0, -s, half + qs, ys);
+    int n2 = solve_quadratic_roots(1.0, s, half - qs, ys + n1);
+    for(int i = 0; i < n1 + n2; ++i) {
+        roots[num++] = ys[i] - a4;
+    }
+    return num;
+}
+
+/**
+ * @brief 计算x处Sturm序列的符号变化次数
+ * @return 符号变化次数
+ * @param seq Sturm序列，每一行为一个多项式的系数，从次数最高的系数开始存储
+ * @param seq_deg 序列中各多项式的次数
+ * @param seq_num 序列中多项式的个数
+ * @param x 自变量
+ */
+int poly_sturm_variations(double const (*seq)[POLY_ROOT_MAX_DEGREE + 1], int const* seq_deg, int seq_num, double x) {
+    int variations = 0;
+    double last = 0.0;
+    for(int i = 0; i < seq_num; ++i) {
+        double val = poly_eval(seq_deg[i], seq[i], x);
+        if(val == 0.0) {
+            continue;
+        }
+        if(last != 0.0 && (val > 0.0) != (last > 0.0)) {
+            ++variations;
+        }
+        last = val;
+    }
+    return variations;
+}
+
+/**
+ * @brief Sturm序列隔离[start, end]内的实根，再用牛顿-二分法精化
+ * @return 根的个数，重根只输出一次
+ * @param degree 多项式的次数，不超过POLY_ROOT_MAX_DEGREE
+ * @param coef 多项式的系数，从次数最高的系数开始存储，要求首项系数不为零
  * @param start
  * @param end [start, end]为所需要根的参数范围
+ * @param roots 输出的根，至少能存放degree个值
  */
-int Equatn(int degree, double* dxyCoef, double*& root, double start, double end) {
-    std::string expression;
-    std::string tmp;
-    for(int i = 0; i < degree; ++i) {
-        if(i) {
-            tmp = std::format("+{}x^{}", dxyCoef[i], degree - i);
-        } else {
-            tmp = std::format("{}x^{}", dxyCoef[i], degree - i);
+int poly_sturm_roots(int degree, double const* coef, double start, double end, double* roots) {
+    double seq[POLY_ROOT_MAX_DEGREE + 1][POLY_ROOT_MAX_DEGREE + 1];
+    int seq_deg[POLY_ROOT_MAX_DEGREE + 1];
+    int seq_num = 0;
+
+    // p0 = p, p1 = p', p(k+1) = -rem(p(k-1), p(k))，每一项按最大系数归一化
+    double scale = 0.0;
+    for(int i = 0; i <= degree; ++i) {
+        scale = std::max(scale, fabs(coef[i]));
+    }
+    for(int i = 0; i <= degree; ++i) {
+        seq[0][i] = coef[i] / scale;
+        seq[1][i] = seq[0][i] * (degree - i);
+    }
+    seq_deg[0] = degree;
+    seq_deg[1] = degree - 1;
+    seq_num = 2;
+    while(seq_deg[seq_num - 1] > 0) {
+        double const* num = seq[seq_num - 2];
+        double const* den = seq[seq_num - 1];
+        int nd = seq_deg[seq_num - 2], dd = seq_deg[seq_num - 1];
+        double rem[POLY_ROOT_MAX_DEGREE + 1];
+        for(int i = 0; i <= nd; ++i) {
+            rem[i] = num[i];
+        }
+        for(int i = 0; i <= nd - dd; ++i) {
+            double factor = rem[i] / den[0];
+            for(int j = 0; j <= dd; ++j) {
+                rem[i + j] -= factor * den[j];
+            }
+        }
+        // 余式位于rem[nd-dd+1 .. nd]，去掉舍入误差产生的首项零系数
+        int first = nd - dd + 1;
+        double rem_scale = 0.0;
+        for(int i = first; i <= nd; ++i) {
+            rem_scale = std::max(rem_scale, fabs(rem[i]));
+        }
+        if(rem_scale <= 1e-12) {  // 余式为零，p含重因子，序列到此结束
+            break;
+        }
+        while(fabs(rem[first]) <= 1e-12 * rem_scale) {
+            ++first;
+        }
+        double* next = seq[seq_num];
+        seq_deg[seq_num] = nd - first;
+        for(int i = first; i <= nd; ++i) {
+            next[i - first] = -rem[i] / rem_scale;
+        }
+        ++seq_num;
+    }
+
+    // 稍微放大区间以包含端点处的根，精化后的根再截断回[start, end]
+    double eps = 1e-12 * (1.0 + std::max(fabs(start), fabs(end)));
+    double tol = 1e-15 * (1.0 + std::max(fabs(start), fabs(end)));
+    struct SturmInterval {
+        double a, b;
+        int va, vb;
+    };
+    SturmInterval stack[2 * POLY_ROOT_MAX_DEGREE + 2];
+    int top = 0;
+    stack[top++] = {start - eps, end + eps, poly_sturm_variations(seq, seq_deg, seq_num, start - eps), poly_sturm_variations(seq, seq_deg, seq_num, end + eps)};
+    int num = 0;
+    while(top > 0 && num < degree) {
+        SturmInterval cur = stack[--top];
+        int count = cur.va - cur.vb;
+        if(count <= 0) {
+            continue;
+        }
+        double fa = poly_eval(degree, coef, cur.a), fb = poly_eval(degree, coef, cur.b);
+        if(count == 1 && fa * fb < 0.0) {  // 单根且端点变号，牛顿-二分法求解
+            double lo = cur.a, hi = cur.b, x = 0.5 * (lo + hi);
+            for(int iter = 0; iter < 100 && hi - lo > tol; ++iter) {
+                double f = 0.0, df = 0.0;
+                poly_eval_deriv(degree, coef, x, f, df);
+                if(f == 0.0) {
+                    break;
+                }
+                if((f < 0.0) == (fa < 0.0)) {
+                    lo = x;
+                } else {
+                    hi = x;
+                }
+                double next = (df != 0.0) ? x - f / df : lo - 1.0;
+                x = (next > lo && next < hi) ? next : 0.5 * (lo + hi);
+            }
+            roots[num++] = x;
+            continue;
+        }
+        double mid = 0.5 * (cur.a + cur.b);
+        if(cur.b - cur.a <= tol) {  // 区间已足够小，多个根聚集时只输出一次
+            roots[num++] = mid;
+            continue;
         }
-        expression += dxyCoef[i] < 0 ? std::format("-{}x^{}", -dxyCoef[i], degree - i) : tmp;  // dxyCoef先从高次系数 再到低次系数
+        int vm = poly_sturm_variations(seq, seq_deg, seq_num, mid);
+        if(cur.va > vm && top < 2 * POLY_ROOT_MAX_DEGREE + 2) {
+            stack[top++] = {cur.a, mid, cur.va, vm};
+        }
+        if(vm > cur.vb && top < 2 * POLY_ROOT_MAX_DEGREE + 2) {
+            stack[top++] = {mid, cur.b, vm, cur.vb};
+        }
+    }
+    for(int i = 0; i < num; ++i) {
+        roots[i] = std::clamp(roots[i], start, end);
+    }
+    return num;
+}
+
+/**
+ * @brief 直接在系数数组上求一元多项式方程在[start, end]内的实根，1~4次用求根公式，更高次用Sturm序列隔离
+ * @return 根的个数，根按升序排列，重根只输出一次
+ * @param degree 多项式方程的最高次数，不超过POLY_ROOT_MAX_DEGREE
+ * @param coef 多项式方程的系数，从次数最高的系数开始存储
+ * @param start
+ * @param end [start, end]为所需要根的参数范围
+ * @param roots 输出的根，由调用者提供，至少能存放degree个值
+ */
+int solve_poly_roots(int degree, double const* coef, double start, double end, double* roots) {
+    if(degree > POLY_ROOT_MAX_DEGREE) {
+        return 0;
+    }
+    if(start > end) {
+        std::swap(start, end);
     }
+    // 首项系数相对为零时降次
+    double scale = 0.0;
+    for(int i = 0; i <= degree; ++i) {
+        scale = std::max(scale, fabs(coef[i]));
+    }
+    if(scale == 0.0) {
+        return 0;
+    }
+    int lead = 0;
+    while(lead < degree && fabs(coef[lead]) <= 1e-14 * scale) {
+        ++lead;
+    }
+    int deg = degree - lead;
+    double const* c = coef + lead;
 
-    expression += dxyCoef[degree] < 0 ? std::format("-{}", -dxyCoef[degree]) : std::format("+{}", dxyCoef[degree]);  // 常数项
+    double cand[POLY_ROOT_MAX_DEGREE];
+    int num_cand = 0;
+    switch(deg) {
+        case 0:
+            return 0;
+        case 1:
+            cand[num_cand++] = -c[1] / c[0];
+            break;
+        case 2:
+            num_cand = solve_quadratic_roots(c[0], c[1], c[2], cand);
+            break;
+        case 3:
+            num_cand = solve_cubic_roots(c[1] / c[0], c[2] / c[0], c[3] / c[0], cand);
+            break;
+        case 4:
+            num_cand = solve_quartic_roots(c[1] / c[0], c[2] / c[0], c[3] / c[0], c[4] / c[0], cand);
+            break;
+        default:
+            num_cand = poly_sturm_roots(deg, c, start, end, cand);
+            break;
+    }
 
-    int number_roots = 0;
-    law* function_law = nullptr;
-    api_str_to_law(expression.c_str(), &function_law);
-    check_outcome(api_nroots_of_law(function_law, start, end, &number_roots, &root));  // @todo: 存在内存泄漏
-    if(function_law) {
-        function_law->remove();
+    double eps = 1e-12 * (1.0 + std::max(fabs(start), fabs(end)));
+    int num = 0;
+    for(int i = 0; i < num_cand; ++i) {
+        double x = (deg <= 4) ? poly_newton_polish(deg, c, cand[i]) : cand[i];
+        if(x < start - eps || x > end + eps) {
+            continue;
+        }
+        roots[num++] = std::clamp(x, start, end);
+    }
+    std::sort(roots, roots + num);
+    // 重根经牛顿迭代后可能略有分离，合并为一个
+    int unique = 0;
+    for(int i = 0; i < num; ++i) {
+        if(unique > 0 && roots[i] - roots[unique - 1] <= 1e-9 * (1.0 + fabs(roots[i]))) {
+            continue;
+        }
+        roots[unique++] = roots[i];
     }
+    return unique;
+}
 
-    return number_roots;
+/**
+ * @brief 求一元n次多项式方程的所有根
+ * @return 根的个数
+ * @param degree 多项式方程的最高次数
+ * @param dxyCoef 存储多项式方程的系数，从次数最高的系数开始存储
+ * @param root 输出所求得的根，求得的根在[start, end]范围内，由调用者提供，至少能存放degree个值
+ * @param start
+ * @param end [start, end]为所需要根的参数范围
+ */
+int Equatn(int degree, double* dxyCoef, double* root, double start, double end) {
+    return solve_poly_roots(degree, dxyCoef, start, end, root);
 }
 
 /**
@@ -801,555 +1378,279 @@ logical check_rational(bs3_curve bs3) {
 }
 
 /**
- * @brief 判断sub_curv1和sub_curv2是否在容差tol内完全重合
- * @return TRUE: 完全重合 FALSE: 不完全重合
- * @param sub_curv1 输入曲线1
- * @param sub_curv2 输入曲线2
- * @param tol 重合容差
- * @param reversed sub_curv1和sub_curv2是否参数化相反
+ * @brief Bezier曲线段第i个控制点的欧氏坐标
  */
-logical test_coin(bs3_curve sub_curv1, bs3_curve sub_curv2, double tol, logical reversed) {
-    if(sub_curv1 == nullptr || sub_curv2 == nullptr) {
-        // split得到的子曲线可能因为参数太接近，而返回nullptr
-        bs3_curve_delete(sub_curv1);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-        bs3_curve_delete(sub_curv2);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-        return FALSE;
-    }
-
-    // 检查包围盒是否重合
-    if(!(bs3_curve_box(sub_curv1, tol) && bs3_curve_box(sub_curv2, tol))) {
-        bs3_curve_delete(sub_curv1);
-        bs3_curve_delete(sub_curv2);
-        return FALSE;
-    }
-
-    if(reversed) {
-        // reversed
-        bs3_curve_reverse(sub_curv2);
-    }
+static SPAposition cci_coin_ctrlpt(CciBezier const& bez, int i) {
+    double w = bez.pts[i][3];
+    return SPAposition(bez.pts[i][0] / w, bez.pts[i][1] / w, bez.pts[i][2] / w);
+}
 
-    if(bs3_curve_rational(sub_curv1) || bs3_curve_rational(sub_curv2)) {  // 待解耦，存在问题 @todo: bs3_curve相关问题
-        // 若两个有一个是rational，则将其转化为nurbs曲线
-        bs3_curve_make_rational(sub_curv1);
-        bs3_curve_make_rational(sub_curv2);
+/**
+ * @brief 求点pos在Bezier曲线段bez上的投影，以等距采样的最近点为初值做Gauss-Newton迭代
+ * @return 投影距离不超过tol时返回true
+ * @param s 输出投影点的局部参数
+ */
+static bool cci_coin_project(CciBezier const& bez, CciBezierOps const& ops, SPAposition const& pos, double tol, double& s) {
+    SPAposition p;
+    SPAvector d;
+    int num_samples = 2 * bez.degree;
+    double best = DBL_MAX;
+    for(int k = 0; k <= num_samples; ++k) {
+        double sk = static_cast<double>(k) / num_samples;
+        ops.eval(bez, sk, p, d);
+        double dist = (p - pos).len_sq();
+        if(dist < best) {
+            best = dist;
+            s = sk;
+        }
+    }
+    for(int iter = 0; iter < 20; ++iter) {
+        ops.eval(bez, s, p, d);
+        double dd = d % d;
+        if(dd < SPAresmch) {
+            break;
+        }
+        double ds = ((pos - p) % d) / dd;
+        double next = std::clamp(s + ds, 0.0, 1.0);
+        ds = next - s;
+        s = next;
+        if(fabs(ds) < SPAresmch) {
+            break;
+        }
     }
-    SPAinterval range1 = bs3_curve_range(sub_curv1);
-    SPAinterval range2 = bs3_curve_range(sub_curv2);
+    ops.eval(bez, s, p, d);
+    return (p - pos).len() <= tol;
+}
 
-    // 重新参数化
-    // 优先重新参数化到大的参数范围，防止节点重数压缩 ConeCylinderTest.Case5
-    if(range1.length() > range2.length()) {
-        bs3_curve_reparam(range1.start_pt(), range1.end_pt(), sub_curv2);
-    } else {
-        bs3_curve_reparam(range2.start_pt(), range2.end_pt(), sub_curv1);
+/**
+ * @brief 求点pos在Bezier曲线段组成的曲线上的所有原像，每段至多一个
+ * @param hits 输出<曲线段序号, 局部参数>
+ */
+static void cci_coin_invert(std::vector<CciBezier> const& beziers, CciBezierOps const& ops, SPAposition const& pos, double tol, std::vector<std::pair<int, double>>& hits) {
+    hits.clear();
+    for(int i = 0; i < static_cast<int>(beziers.size()); ++i) {
+        SPAbox box = ops.box(beziers[i]);
+        if(pos.x() < box.low().x() - tol || pos.x() > box.high().x() + tol || pos.y() < box.low().y() - tol || pos.y() > box.high().y() + tol || pos.z() < box.low().z() - tol || pos.z() > box.high().z() + tol) {
+            continue;
+        }
+        double s = 0.0;
+        if(cci_coin_project(beziers[i], ops, pos, tol, s)) {
+            hits.push_back({i, s});
+        }
     }
-    double *knot1 = nullptr, *knot2 = nullptr;
-    int num_knot1 = 0, num_knot2 = 0;
-
-    bs3_curve_knots(sub_curv1, num_knot1, knot1);
-    bs3_curve_knots(sub_curv2, num_knot2, knot2);
-    double knottol = bs3_curve_knottol();
-
-    // 添加权重归一化
-    bs3_curve_normalise_weight(sub_curv1);
-    bs3_curve_normalise_weight(sub_curv2);
-
-    bs3_curve_normalise_knot(sub_curv1, sub_curv2, tol);
-
-    if(0) {
-        int i = 0, j = 0;
-        int mul1 = 0, mul2 = 0;  // 重数
+}
 
-        // 调整sub_curv1和sub_curv2的节点向量 使其一致
-        for(i = 0; i < num_knot2; ++i) {
-            if(i == 0 || (i > 0 && fabs(knot2[i] - knot2[i - 1]) > knottol)) {
-                mul1 = bs3_curve_knot_mult(sub_curv1, knot2[i], knottol);
-                mul2 = bs3_curve_knot_mult(sub_curv2, knot2[i], knottol);
-                bs3_curve_add_knot(sub_curv1, knot2[i], D3_max(mul1, mul2) - mul1, knottol);
-            }
+/**
+ * @brief Bezier曲线段升阶到degree次，齐次坐标下逐次升阶
+ */
+static void cci_coin_elevate(CciBezier& bez, int degree) {
+    for(int n = bez.degree; n < degree; ++n) {
+        for(int k = 0; k < 4; ++k) {
+            bez.pts[n + 1][k] = bez.pts[n][k];
         }
-
-        for(i = 0; i < num_knot1; ++i) {
-            if(i == 0 || (i > 0 && fabs(knot1[i] - knot1[i - 1]) > knottol)) {
-                mul1 = bs3_curve_knot_mult(sub_curv1, knot1[i], knottol);
-                mul2 = bs3_curve_knot_mult(sub_curv2, knot1[i], knottol);
-                bs3_curve_add_knot(sub_curv2, knot1[i], D3_max(mul1, mul2) - mul2, knottol);
+        for(int i = n; i >= 1; --i) {
+            double a = static_cast<double>(i) / (n + 1);
+            for(int k = 0; k < 4; ++k) {
+                bez.pts[i][k] = a * bez.pts[i - 1][k] + (1.0 - a) * bez.pts[i][k];
             }
         }
     }
+    bez.degree = std::max(bez.degree, degree);
+}
 
-    bs3_curve_normalise_weight(sub_curv1);
-    bs3_curve_normalise_weight(sub_curv2);
-
-    logical coin = FALSE;
-    // 判断控制多边形是否重合
-    if(cucuint_bs3_curve_same(sub_curv1, sub_curv2, tol * 10, TRUE)) {
-        coin = TRUE;
+/**
+ * @brief 权重归一化，以Mobius重新参数化使首末权重均为1，曲线形状不变
+ */
+static void cci_coin_normalise_weight(CciBezier& bez) {
+    int n = bez.degree;
+    double w0 = bez.pts[0][3], wn = bez.pts[n][3];
+    if(n == 0 || w0 <= 0.0 || wn <= 0.0) {
+        return;
+    }
+    double c = pow(w0 / wn, 1.0 / n), scale = 1.0 / w0;
+    for(int i = 0; i <= n; ++i, scale *= c) {
+        for(int k = 0; k < 4; ++k) {
+            bez.pts[i][k] *= scale;
+        }
     }
-    bs3_curve_delete(sub_curv1);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-    bs3_curve_delete(sub_curv2);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-    ACIS_DELETE[] STD_CAST knot1;
-    ACIS_DELETE[] STD_CAST knot2;
-    knot1 = knot2 = nullptr;
-    return coin;
 }
 
 /**
- * @brief 判断bs3在param处的点是否为bs3的一个自交点
- * @return FALSE: 该点不是自交点
- *         TRUE: 该点是自交点
- * @param param 输入参数
- * @param bs3 输入曲线
- * @param next_param 输出的参数 若该点不为自交点 next_param为param值
- *                              若该点为自交点 next_param为bs在该自交点处的另一个参数
- * @param tol 容差
+ * @brief 判断两段Bezier曲线在容差内是否重合，升阶至相同次数并归一化权重后比较控制多边形
+ * 权重一致时曲线上对应点的距离不超过控制点距离的最大值，以此作为两段曲线Hausdorff距离的上界
+ * @param reversed b与a参数化方向相反
  */
-logical test_self_inter_point(double param, bs3_curve bs3, double& next_param, double tol) {
-    logical is_self_inter_point = FALSE;
-    if(bs3) {
-        SPAinterval bs3_range = bs3_curve_range(bs3);
-        if(param << bs3_range) {
-            const double margin = tol * 10;
-            // @todo: bs3_curve_split存在问题之后统一解耦
-            bs3_curve bs3_copy = bs3_curve_copy(bs3);
-            bs3_curve st_curv = bs3_curve_split(bs3_copy, param - margin);
-            bs3_curve ed_curv = bs3_copy;
-            bs3_copy = bs3_curve_split(ed_curv, param + margin);
-
-            SPAposition pos = bs3_curve_position(param, bs3);
-            if(st_curv && bs3_curve_testpt(pos, tol, st_curv)) {
-                is_self_inter_point = TRUE;
-                next_param = bs3_curve_invert(pos, tol, st_curv);
-            }
-            if(!is_self_inter_point && ed_curv && bs3_curve_testpt(pos, tol, ed_curv)) {
-                is_self_inter_point = TRUE;
-                next_param = bs3_curve_invert(pos, tol, ed_curv);
-            }
-            bs3_curve_delete(bs3_copy);
-            bs3_copy = st_curv = ed_curv = nullptr;
-            // 存在next_param位于曲线范围外的情况
-            if(is_self_inter_point == TRUE && !next_param << bs3_range) {
-                is_self_inter_point = FALSE;
-            }
-        }
+static bool cci_coin_bezier_same(CciBezier a, CciBezier b, logical reversed, double tol) {
+    CCI_STAT_INC(coin_tests);
+    if(reversed) {
+        std::reverse(&b.pts[0], &b.pts[b.degree + 1]);
     }
-    if(!is_self_inter_point) {
-        next_param = param;
+    int degree = std::max(a.degree, b.degree);
+    cci_coin_elevate(a, degree);
+    cci_coin_elevate(b, degree);
+    cci_coin_normalise_weight(a);
+    cci_coin_normalise_weight(b);
+    for(int i = 0; i <= degree; ++i) {
+        if(fabs(a.pts[i][3] - b.pts[i][3]) > tol || (cci_coin_ctrlpt(a, i) - cci_coin_ctrlpt(b, i)).len() > tol) {
+            return false;
+        }
     }
-    return is_self_inter_point;
+    return true;
 }
 
 /**
- * @brief 检查曲线curv1在param1，curv2在param2上是否重合
- * @return 0: 不重合 1: 正向重合(切向方向相同) 2: 反向重合(切向方向相反) 3: 多种重合情况(自交点或闭曲线端点)
- * @param curv1 输入曲线1
- * @param curv2 输入曲线2
- * @param param1 输入参数1
- * @param param2 输入参数2
- * @param tol 容差
- * @param check_self_point 是否检查曲线在参数处的自交点和闭曲线的端点
- * @param records 返回的重合记录，包括参数所在点处的所有重合记录 记录格式为<重合关系, param1, param2>
- */
-int test_coincident(bs3_curve curv1, bs3_curve curv2, double param1, double param2, double tol, logical check_self_point, std::vector<std::tuple<int, double, double>>* records) {
-    if(check_self_point && records) {
-        records->clear();
-        double next_param1 = param1, next_param2 = param2;
-
-        // 暂时不判断自交点
-        // int self_point1 = test_self_inter_point(param1, curv1, next_param1, tol);
-        // int self_point2 = test_self_inter_point(param2, curv2, next_param2, tol);
-        int self_point1 = 0;
-        int self_point2 = 0;
-
-        int count1 = self_point1 + 1;
-        int count2 = self_point2 + 1;
-        double param1_list[3] = {param1, next_param1};
-        double param2_list[3] = {param2, next_param2};
-        bool is_end1 = 0, is_end2 = 0;
-        // check close and periodic curve ends
-        // @todo:  bs3_curve_closed、bs3_curve_periodic、bs3_curve_range函数未解耦
-        if((bs3_curve_closed(curv1) || bs3_curve_periodic(curv1))) {
-            SPAinterval range = bs3_curve_range(curv1);
-            if(fabs(param1 - range.start_pt()) <= tol) {
-                param1_list[count1++] = range.end_pt();
-                is_end1 = true;
-            } else if(fabs(param1 - range.end_pt()) <= tol) {
-                is_end1 = true;
-                param1_list[count1++] = range.start_pt();
-            }
-        }
-        if((bs3_curve_closed(curv2) || bs3_curve_periodic(curv2))) {
-            SPAinterval range = bs3_curve_range(curv2);
-            if(fabs(param2 - range.start_pt()) <= tol) {
-                param2_list[count2++] = range.end_pt();
-                is_end2 = true;
-            } else if(fabs(param2 - range.end_pt()) <= tol) {
-                param2_list[count2++] = range.start_pt();
-                is_end2 = true;
-            }
-        }
-
-        int coin_ret = 0;
-        if(is_end1 && is_end2) {
-            const double margin = tol * 100;
-            SPAinterval range1 = bs3_curve_range(curv1), range2 = bs3_curve_range(curv2);
-            // 考虑nurbs曲线参数化的不同,此处反求参数
-            SPAposition pos1 = bs3_curve_position(range1.start_pt() + margin, curv1);
-            SPAposition pos2 = bs3_curve_position(range1.end_pt() - margin, curv1);
-            double st2 = bs3_curve_invert(pos1, SPAresabs, curv2);
-            double ed2 = bs3_curve_invert(pos2, SPAresabs, curv2);
-            if((coin_ret = test_coincident(curv1, curv2, range1.start_pt() + margin, st2, tol)) != 0) {
-                double _st2 = coin_ret == 1 ? range2.start_pt() : range2.end_pt();
-                records->push_back({coin_ret, range1.start_pt(), _st2});  // @todo: 端点参数判断
-            }
-            if((coin_ret = test_coincident(curv1, curv2, range1.end_pt() - margin, ed2, tol)) != 0) {
-                double _ed2 = coin_ret == 1 ? range2.end_pt() : range2.start_pt();
-                records->push_back({coin_ret, range1.end_pt(), _ed2});
-            }
-        } else {
-            for(int i = 0; i < count1; ++i) {
-                for(int j = 0; j < count2; ++j) {
-                    if((coin_ret = test_coincident(curv1, curv2, param1_list[i], param2_list[j], tol)) != 0) {
-                        records->push_back({coin_ret, param1_list[i], param2_list[j]});
-                    }
-                }
-            }
-        }
-        return records->empty() ? 0 : 3;  // 3代表混合记录
-    } else {
-        tol *= 10;  // 调整容差
-        double G2_tol = 5 * tol;
-        /** @todo: 有容差的重合检测，如何调整容差 */
-        if(curv1 && curv2) {
-            SPAposition pos_cur1 = bs3_curve_position(param1, curv1), pos_cur2 = bs3_curve_position(param2, curv2);
-            if(distance_to_point(pos_cur1, pos_cur2) > tol) {
-                return 0;
-            }
-
-            logical irr1 = check_irregular_G1(curv1, param1);
-            logical irr2 = check_irregular_G1(curv2, param2);
-
-            SPAvector dt_cur1, dt_cur2;
-            if(irr1 || irr2) {
-                double margin = SPAresabs;
-                dt_cur1 = bs3_curve_deriv(param1 - margin, curv1), dt_cur2 = bs3_curve_deriv(param2 - margin, curv2);
-                // G1连续即可，不用C1连续(模长不用比较)
-                bool flag = false;
-                if(biparallel(dt_cur1, dt_cur2, tol)) {
-                    flag = true;
-                    SPAvector k_cur1 = bs3_curve_curvature(param1 - margin, curv1), k_cur2 = bs3_curve_curvature(param2 - margin, curv2);
-                    double angle = VEC_acute_angle(k_cur1, k_cur2);
-                    // if(fabs(k_cur1.len() - k_cur2.len()) > C2_tol) {  // C2连续
-                    if(fabs(angle) > G2_tol) {  // G2连续
-                        return 0;
-                    }
-                }
-
-                if(!flag && (dt_cur1 = bs3_curve_deriv(param1 + margin, curv1), dt_cur2 = bs3_curve_deriv(param2 + margin, curv2), biparallel(dt_cur1, dt_cur2, tol))) {
-                    flag = true;
-                    SPAvector k_cur1 = bs3_curve_curvature(param1 + margin, curv1), k_cur2 = bs3_curve_curvature(param2 + margin, curv2);
-                    // if(fabs(k_cur1.len() - k_cur2.len()) > C2_tol) {  // C2连续
-                    double angle = VEC_acute_angle(k_cur1, k_cur2);
-                    if(fabs(angle) > G2_tol) {  // G2连续
-                        return 0;
-                    }
-                }
-
-                if(!flag) {
-                    return 0;
-                }
-            } else {
-                dt_cur1 = bs3_curve_deriv(param1, curv1), dt_cur2 = bs3_curve_deriv(param2, curv2);
-                // if(dt_cur1.len_sq() - dt_cur2.len_sq() > tol || !biparallel(dt_cur1, dt_cur2, tol)) {
-                if(!biparallel(dt_cur1, dt_cur2, tol)) {  // G1连续
-                    return 0;
-                }
-                SPAvector k_cur1 = bs3_curve_curvature(param1, curv1), k_cur2 = bs3_curve_curvature(param2, curv2);
-                double k1 = k_cur1.len();
-                double k2 = k_cur2.len();
-                double angle = VEC_acute_angle(k_cur1, k_cur2);
-                if(fabs(angle) > G2_tol) {  // G2连续
-                    // if(fabs(k_cur1.len() - k_cur2.len()) > C2_tol) {  // C2连续
-                    return 0;
-                }
-            }
-            // parallel存在问题 PlaneTorusInterTest.Case6
-            if(parallel(dt_cur1, dt_cur2, tol)) {
-                return 1;  // 同向重合
-            } else if(antiparallel(dt_cur1, dt_cur2, tol)) {
-                return 2;  // 反向重合
-            } else {
-                return 0;
-            }
-        }
-        return 0;
-    }
-}
-
-/**
- * @brief 样条曲线重合检测
- * @return 返回重合的段数 返回0：不重合
+ * @brief 样条曲线重合检测
+ * 两条曲线均分解为Bezier曲线段，curv2的分段点投影到curv1上与curv1的分段点合并，
+ * 相邻分段点之间的每一小段在curv2上的像落在同一Bezier曲线段内，比较两段子曲线的控制多边形判断重合，
+ * 再把首尾相接且方向一致的重合小段合并为最大重合区间
+ * @return 返回重合的段数 返回0：不重合
  * @param curv1 输入曲线1
  * @param curv2 输入曲线2
  * @param inters 重合的交点结果
  * @param inter_ints1 所有重合段在curv1的参数区间
  * @param inter_ints2 所有重合段在curv2的参数区间
  * @param tol 重合检测容差
+ * @param beziers1 curv1已分解的Bezier曲线段，为空时由curv1分解
+ * @param beziers2 curv2已分解的Bezier曲线段，为空时由curv2分解
  */
-int detect_coincident(bs3_curve curv1, bs3_curve curv2, curve_curve_int*& inters, std::vector<SPAinterval>& inter_ints1, std::vector<SPAinterval>& inter_ints2, double tol) {
+int detect_coincident(bs3_curve curv1, bs3_curve curv2, curve_curve_int*& inters, std::vector<SPAinterval>& inter_ints1, std::vector<SPAinterval>& inter_ints2, double tol, std::vector<CciBezier> const* beziers1, std::vector<CciBezier> const* beziers2) {
     inter_ints1.clear();
     inter_ints2.clear();
+    inters = nullptr;
     if(curv1 == nullptr || curv2 == nullptr) {
-        inters = nullptr;
         return 0;
     }
+    CCI_STAT_TIMER(detect_coincident);
     if(!(bs3_curve_box(curv1, tol) && bs3_curve_box(curv2, tol))) {
-        inters = nullptr;
-        return 0;
-    }
-    int degree1 = bs3_curve_degree(curv1), degree2 = bs3_curve_degree(curv2);
-    /** @todo: 三次以上的重合判断 有待后续添加 */
-    if(degree1 > 3 || degree2 > 3) {
-        inters = nullptr;
         return 0;
     }
-    int i = 0, j = 0;
-    bs3_curve curv1_cp = bs3_curve_copy(curv1), curv2_cp = bs3_curve_copy(curv2);
-
-    // 使curv1_cp和curv2_cp的次数一致
-    int degree = D3_max(degree1, degree2);
-    for(i = 1; i <= degree - degree1; ++i) {
-        bs3_curve_degree_elevate(curv1_cp);  // @todo: 中断 CstrFuncTest.LoopTypeTest16
-    }
-    for(i = 1; i <= degree - degree2; ++i) {
-        bs3_curve_degree_elevate(curv2_cp);
-    }
-
-    // 获取curv1_cp的节点向量knot1，curv2_cp的节点向量knot2
-    double *knot1 = nullptr, *knot2 = nullptr;
-    int num_knot1 = 0, num_knot2 = 0;
-    bs3_curve_knots(curv1_cp, num_knot1, knot1);
-    bs3_curve_knots(curv2_cp, num_knot2, knot2);
-
-    double *nknot1 = nullptr, *nknot2 = nullptr;
-    nknot1 = ACIS_NEW double[num_knot1];
-    nknot2 = ACIS_NEW double[num_knot2];
-    int distinct_nknot1 = 0, distinct_nknot2 = 0;
-    GetKnotNoRepeat(num_knot1, distinct_nknot1, knot1, nknot1);  // 将knot1去重 去重后的节点向量存于nknot1
-    GetKnotNoRepeat(num_knot2, distinct_nknot2, knot2, nknot2);  // 将knot2去重 去重后的节点向量存于nknot2
-
-    double param1 = NAN, param2 = NAN, param = NAN;
-    std::vector<double> param1_array;  // 可能重合的段在曲线1上的参数
-    SPAposition pos1, pos2, pos;
-    SPAposition end1 = bs3_curve_end(curv1), end2 = bs3_curve_end(curv2);                // 曲线2的端点
-    logical no_open1 = 1 - bs3_curve_open(curv2), no_open2 = 1 - bs3_curve_open(curv2);  // 曲线2是否为闭曲线或者周期曲线
-    SPAinterval range1 = bs3_curve_range(curv1), range2 = bs3_curve_range(curv2);
-
-    double invert_tol = tol;  // 1e-10
-    double knottol = bs3_curve_knottol();
-    for(i = 0; i < distinct_nknot1; ++i) {
-        // @todo:bs3_curve_position耗时过长暂不解耦
-        pos = bs3_curve_position(nknot1[i], curv1_cp);     // @todo: 耗时较长
-        if(bs3_curve_testpt(pos, invert_tol, curv2_cp)) {  // 待解耦，存在问题 @todo: bs3_curve相关问题
-            param1_array.push_back(nknot1[i]);
+    std::vector<CciBezier> local1, local2;
+    if(!beziers1 || beziers1->empty()) {
+        if(!cci_nurbs_to_beziers(curv1, local1)) {
+            return 0;  // 次数超过CCI_BEZIER_MAX_ORDER或节点向量无效
         }
+        beziers1 = &local1;
     }
-
-    for(i = 0; i < distinct_nknot2; ++i) {
-        // @todo:bs3_curve_position耗时过长暂不解耦
-        pos = bs3_curve_position(nknot2[i], curv2_cp);            // @todo: 耗时较长
-        if(bs3_curve_testpt(pos, invert_tol, curv1_cp)) {         // 待解耦，存在问题 @todo: bs3_curve相关问题
-            param = bs3_curve_invert(pos, invert_tol, curv1_cp);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-            param1_array.push_back(param);
-            if(no_open1 && is_equal(pos, end1)) {
-                param1_array.push_back(range1.end_pt());
-            }
+    if(!beziers2 || beziers2->empty()) {
+        if(!cci_nurbs_to_beziers(curv2, local2)) {
+            return 0;
         }
+        beziers2 = &local2;
     }
-    std::sort(param1_array.begin(), param1_array.end());
-    auto compare = [knottol](double p1, double p2) { return fabs(p1 - p2) <= knottol; };  // 此处设置为knottol 1e-10
-    param1_array.erase(std::unique(param1_array.begin(), param1_array.end(), compare), param1_array.end());
+    std::vector<CciBezier> const& bezs1 = *beziers1;
+    std::vector<CciBezier> const& bezs2 = *beziers2;
+    CciBezierOps const& ops1 = cci_bezier_ops(bezs1);
+    CciBezierOps const& ops2 = cci_bezier_ops(bezs2);
 
-    curve_curve_int *head = nullptr, *end = nullptr, *inter1 = nullptr, *inter2 = nullptr;
-    int num_segs = 0;  // 重合的段数
-    head = end = ZeroInter;
-    double start_param1 = NAN, end_param1 = NAN, start_param2 = NAN, end_param2 = NAN;
-    double start_param[4], end_param[4];
-    std::vector<std::pair<curve_curve_int*, curve_curve_int*>> inters_list;
-
-    std::vector<std::tuple<int, double, double>> coin_records;  // 重合记录
-    std::vector<std::tuple<int, double, double>> tmp_records;
-    for(i = 0; i < static_cast<int>(param1_array.size()); ++i) {
-        double st1 = param1_array[i];
-        // @todo:bs3_curve_position耗时过长暂不解耦
-        SPAposition pos = bs3_curve_position(st1, curv1_cp);
-        double st2 = bs3_curve_invert(pos, invert_tol, curv2_cp);
-        int coin = test_coincident(curv1_cp, curv2_cp, st1, st2, tol, TRUE, &tmp_records);
-        if(coin != 0) {
-            coin_records.insert(coin_records.end(), tmp_records.begin(), tmp_records.end());
-        }
-    }
-    // sort coin_records
-    std::sort(coin_records.begin(), coin_records.end());
-
-    // 对coin_records进行去重
-    auto tcompare = [knottol](std::tuple<int, double, double> const& v1, std::tuple<int, double, double> const& v2) {
-        return std::get<0>(v1) == std::get<0>(v2) && fabs(std::get<1>(v1) - std::get<1>(v2)) <= knottol && fabs(std::get<2>(v1) - std::get<2>(v2)) <= knottol;
+    double coin_tol = tol * 10;  // 控制多边形比较使用10倍容差
+    double knottol = bs3_curve_knottol();
+    double period2 = bs3_curve_periodic(curv2) ? bs3_curve_period(curv2) : 0.0;
+    auto global1 = [&bezs1](int i, double s) { return bezs1[i].t0 + s * (bezs1[i].t1 - bezs1[i].t0); };
+    auto global2 = [&bezs2](int j, double s) { return bezs2[j].t0 + s * (bezs2[j].t1 - bezs2[j].t0); };
+
+    // curv1上的分段点: curv1自身的Bezier分段点，以及curv2的Bezier分段点在curv1上的所有原像
+    std::vector<double> breaks;
+    for(auto const& bez: bezs1) {
+        breaks.push_back(bez.t0);
+    }
+    breaks.push_back(bezs1.back().t1);
+    std::vector<std::pair<int, double>> hits;
+    for(int j = 0; j <= static_cast<int>(bezs2.size()); ++j) {
+        SPAposition pos = j < static_cast<int>(bezs2.size()) ? cci_coin_ctrlpt(bezs2[j], 0) : cci_coin_ctrlpt(bezs2.back(), bezs2.back().degree);
+        cci_coin_invert(bezs1, ops1, pos, coin_tol, hits);
+        for(auto const& hit: hits) {
+            breaks.push_back(global1(hit.first, hit.second));
+        }
+    }
+    std::sort(breaks.begin(), breaks.end());
+    breaks.erase(std::unique(breaks.begin(), breaks.end(), [knottol](double p1, double p2) { return fabs(p1 - p2) <= knottol; }), breaks.end());
+
+    // curv1在各分段点及各小段中点处的位置批量求值
+    int num_breaks = static_cast<int>(breaks.size());
+    std::vector<double> samples(breaks);
+    for(int k = 0; k + 1 < num_breaks; ++k) {
+        samples.push_back(0.5 * (breaks[k] + breaks[k + 1]));
+    }
+    CciBs3Evaluator evaluator1;
+    evaluator1.init(bezs1);
+    std::vector<SPAposition> sample_pos = evaluator1.positions(samples);
+
+    // 逐小段扫描，首尾相接且方向一致的重合小段直接并入当前重合区间
+    struct CoinRun {
+        double st1, ed1, st2, ed2;
+        SPAposition st_pos, ed_pos;
+        logical reversed;
     };
-    coin_records.erase(std::unique(coin_records.begin(), coin_records.end(), tcompare), coin_records.end());
-
-    for(int i = 0; i < coin_records.size(); ++i) {
-        if(i && std::get<0>(coin_records[i]) == 1 && std::get<2>(coin_records[i]) - std::get<2>(coin_records[i - 1]) < -knottol) {
-            // last_i 为 不满足同向重合的点，考虑该点有多个参数 交换同一个点在coin_records的相对顺序
-            int last_pos = i - 1, last_i = i;
-            double last_param1 = std::get<1>(coin_records[last_i]);
-            double last_param2 = std::get<2>(coin_records[last_pos]);
-            while(i + 1 < coin_records.size() && fabs(std::get<1>(coin_records[i + 1]) - last_param1) <= knottol && std::get<2>(coin_records[i + 1]) - last_param2 < -knottol) ++i;
-            if(i + 1 < coin_records.size() && fabs(std::get<1>(coin_records[i + 1]) - last_param1) <= knottol && std::get<2>(coin_records[i + 1]) - last_param2 >= -knottol) {
-                std::swap(coin_records[last_i], coin_records[i + 1]);
-            }
-            i = last_i;
+    std::vector<CoinRun> runs;
+    int i1 = 0;
+    for(int k = 0; k + 1 < num_breaks; ++k) {
+        double u0 = breaks[k], u1 = breaks[k + 1];
+        if(u1 - u0 <= knottol) {
+            continue;
         }
-    }
-
-    if(!coin_records.empty()) {
-        auto iter = std::upper_bound(coin_records.begin(), coin_records.end(), 1, [](int val, std::tuple<int, double, double> p) { return val < std::get<0>(p); });
-        int non_reverse_num = iter - coin_records.begin();
-        int nums[2] = {non_reverse_num, static_cast<int>(coin_records.size()) - non_reverse_num};
-
-        std::vector<std::vector<double>> coin_array;
-        std::vector<std::vector<double>> coin_array_source1;
-        std::vector<std::vector<double>> coin_array_source2;
-        double st1, st2, ed1, ed2;
-        auto iter_start = coin_records.begin(), iter_end = coin_records.begin();
-        for(int i = 0; i < 2; ++i) {
-            if(iter_start == coin_records.end()) {
-                break;
+        double um = 0.5 * (u0 + u1);
+        while(i1 + 1 < static_cast<int>(bezs1.size()) && bezs1[i1].t1 <= um) {
+            ++i1;
+        }
+        CciBezier const& bez1 = bezs1[i1];
+        double len1 = bez1.t1 - bez1.t0;
+        double a1 = std::clamp((u0 - bez1.t0) / len1, 0.0, 1.0), b1 = std::clamp((u1 - bez1.t0) / len1, 0.0, 1.0);
+        SPAposition const& pa = sample_pos[k];
+        SPAposition const& pb = sample_pos[k + 1];
+        SPAposition const& pm = sample_pos[num_breaks + k];
+        cci_coin_invert(bezs2, ops2, pm, coin_tol, hits);
+        for(auto const& hit: hits) {
+            CciBezier const& bez2 = bezs2[hit.first];
+            double sa = 0.0, sb = 0.0;
+            if(!cci_coin_project(bez2, ops2, pa, coin_tol, sa) || !cci_coin_project(bez2, ops2, pb, coin_tol, sb) || fabs(sb - sa) <= knottol) {
+                continue;
             }
-            iter_end += nums[i];
-            auto iter_next = iter_start + 1;
-            auto iter_pre = iter_start;
-            bool incresed;
-            while(iter_next < iter_end) {
-                incresed = false;
-                // 单调增加
-                while(iter_next != iter_end && std::get<2>(*iter_next) >= std::get<2>(*iter_pre)) {
-                    incresed = true;
-                    iter_pre = iter_next;
-                    iter_next++;
-                }
-                // 单调减少
-                while(!incresed && iter_next != iter_end && std::get<2>(*iter_next) <= std::get<2>(*iter_pre)) {
-                    iter_pre = iter_next;
-                    iter_next++;
-                }
-                coin_array.push_back({std::get<1>(*iter_start), std::get<1>(*iter_pre), std::get<2>(*iter_start), std::get<2>(*iter_pre), 1.0 - i});
-
-                auto tmp = iter_start;
-                std::vector<double> source1, source2;
-                while(tmp <= iter_pre) {
-                    source1.push_back(std::get<1>(*tmp));
-                    source2.push_back(std::get<2>(*tmp));
-                    ++tmp;
+            logical reversed = sb < sa ? TRUE : FALSE;
+            CciBezier sub1, sub2;
+            cci_bezier_sub(bez1, a1, b1, sub1, &ops1);
+            cci_bezier_sub(bez2, std::min(sa, sb), std::max(sa, sb), sub2, &ops2);
+            if(!cci_coin_bezier_same(sub1, sub2, reversed, coin_tol)) {
+                continue;
+            }
+            double v0 = global2(hit.first, sa), v1 = global2(hit.first, sb);
+            CoinRun* last = runs.empty() ? nullptr : &runs.back();
+            if(last && last->reversed == reversed && fabs(last->ed1 - u0) <= knottol) {
+                // 周期曲线curv2越过参数分界时平移一个周期，保持重合区间在curv2上连续
+                double shift = 0.0;
+                if(period2 > 0.0 && fabs(fabs(v0 - last->ed2) - period2) <= tol) {
+                    shift = last->ed2 - v0;
                 }
-                coin_array_source1.push_back(source1);
-                coin_array_source2.push_back(source2);
-                iter_start = iter_pre;
-            }
-            iter_start = iter_end;
-        }
-        for(int i = 0; i < coin_array.size(); ++i) {
-            st1 = coin_array[i][0];
-            ed1 = coin_array[i][1];
-            st2 = coin_array[i][2];
-            ed2 = coin_array[i][3];
-            logical reversed = fabs(coin_array[i][4]) <= SPAresabs ? TRUE : FALSE;
-
-            auto const& source1 = coin_array_source1[i];
-            auto const& source2 = coin_array_source2[i];
-
-            bs3_curve sub_curv1 = bs3_curve_split_interval(curv1_cp, st1, ed1);
-            bs3_curve sub_curv2 = bs3_curve_split_interval(curv2_cp, st2, ed2);
-
-            if(sub_curv1 && sub_curv2) {
-                nurbs_to_multiple_rbeziers(sub_curv1);
-                nurbs_to_multiple_rbeziers(sub_curv2);
-                // @todo: 需要测试是否需要下面的部分
-                // double knottol = bs3_curve_knottol();  // 调整容差，避免出现在bezier结点附近插入结点
-                //// 注意 该容差不能小于1e-10
-                for(int i = 0; i < source1.size(); ++i) {
-                    int multi1 = bs3_curve_knot_mult(sub_curv1, source1[i], knottol);
-                    int i1 = bs3_curve_add_knot(sub_curv1, source1[i], std::max(0, degree - multi1), knottol);
-                    int multi2 = bs3_curve_knot_mult(sub_curv2, source2[i], knottol);
-                    int i2 = bs3_curve_add_knot(sub_curv2, source2[i], std::max(0, degree - multi2), knottol);
+                if(fabs(v0 + shift - last->ed2) <= tol) {
+                    last->ed1 = u1;
+                    last->ed2 = v1 + shift;
+                    last->ed_pos = pb;
+                    break;
                 }
             }
-
-            if(test_coin(sub_curv1, sub_curv2, tol, reversed)) {
-                // @todo:bs3_curve_position耗时过长暂不解耦
-                pos1 = bs3_curve_position(st1, curv1_cp);
-                end->next = ACIS_NEW curve_curve_int(nullptr, pos1, st1, st2);
-                end->next->low_rel = curve_curve_rel::cur_cur_unknown;
-                end->next->high_rel = curve_curve_rel::cur_cur_coin;
-                end = end->next;
-                inter1 = end;
-
-                // @todo:bs3_curve_position耗时过长暂不解耦
-                pos2 = bs3_curve_position(ed1, curv1_cp);
-                end->next = ACIS_NEW curve_curve_int(nullptr, pos2, ed1, ed2);
-                end->next->low_rel = curve_curve_rel::cur_cur_coin;
-                end->next->high_rel = curve_curve_rel::cur_cur_unknown;
-                end = end->next;
-                inter2 = end;
-                inters_list.push_back(std::make_pair(inter1, inter2));
-                num_segs++;
-            }
+            runs.push_back({u0, u1, v0, v1, pa, pb, reversed});
+            break;
         }
     }
 
-    // 合并与去除重合区间
-    num_segs = merge_coin_inters(inters_list, tol);
-
-    if(num_segs > 0) {
-        end = head;
-        // 重新连接求交结果
-        for(i = 0; i < inters_list.size(); ++i) {
-            if(inters_list[i].first) {
-                end->next = inters_list[i].first;
-                end = end->next;
-            }
-            if(inters_list[i].second) {
-                end->next = inters_list[i].second;
-                end = end->next;
-            }
-            if(inters_list[i].first && inters_list[i].second) {
-                inter_ints1.push_back(SPAinterval(inters_list[i].first->param1, inters_list[i].second->param1));
-                inter_ints2.push_back(SPAinterval(inters_list[i].first->param2, inters_list[i].second->param2));
-            }
-        }
-    }
+    curve_curve_int *head = ZeroInter, *end = head;
+    for(auto const& run: runs) {
+        end->next = cci_new_inter(nullptr, run.st_pos, run.st1, run.st2);
+        end->next->low_rel = curve_curve_rel::cur_cur_unknown;
+        end->next->high_rel = curve_curve_rel::cur_cur_coin;
+        end = end->next;
 
-    end->next = nullptr;
+        end->next = cci_new_inter(nullptr, run.ed_pos, run.ed1, run.ed2);
+        end->next->low_rel = curve_curve_rel::cur_cur_coin;
+        end->next->high_rel = curve_curve_rel::cur_cur_unknown;
+        end = end->next;
 
-    if(inter_ints1.size() == 1 && inter_ints2.size() == 1 && bs3_curve_periodic(curv1_cp) && bs3_curve_periodic(curv2_cp)) {
-        if(inter_ints1[0] == range1 && inter_ints2[0].length() <= SPAresabs) {
-            inter_ints2[0] = SPAinterval(inter_ints2[0].start_pt(), inter_ints2[0].start_pt() + bs3_curve_period(curv2_cp));
-            if(head->next && head->next->next) {
-                head->next->next->param2 = inter_ints2[0].end_pt();
-            }
-        }
+        inter_ints1.push_back(SPAinterval(run.st1, run.ed1));
+        inter_ints2.push_back(SPAinterval(run.st2, run.ed2));
     }
-    ACIS_DELETE[] STD_CAST knot1;
-    ACIS_DELETE[] STD_CAST knot2;
-    ACIS_DELETE[] STD_CAST nknot1;
-    ACIS_DELETE[] STD_CAST nknot2;
-    bs3_curve_delete(curv1_cp);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-    bs3_curve_delete(curv2_cp);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-    curv1_cp = curv2_cp = nullptr;
+    end->next = nullptr;
     inters = head->next;
-    ACIS_DELETE head;
-    knot1 = knot2 = nknot1 = nknot2 = nullptr;
-    return num_segs;
+    cci_delete_inter(head);
+    return static_cast<int>(runs.size());
 }
 
 /**
@@ -1360,23 +1661,41 @@ int detect_coincident(bs3_curve curv1, bs3_curve curv2, curve_curve_int*& inters
  */
 curve_curve_int* delete_coin(curve_curve_int* inters, std::vector<SPAinterval> const& coin_ints) {
     if(coin_ints.size() > 0) {
-        int i = 0;
+        // 有界区间按起点排序并记录前缀最大终点，每个交点只需检查起点不超过param1的区间，且从后向前遇到前缀最大终点小于param1时即可停止
+        std::vector<int> bounded, unbounded;
+        for(int i = 0; i < coin_ints.size(); ++i) {
+            (coin_ints[i].bounded() ? bounded : unbounded).push_back(i);
+        }
+        std::sort(bounded.begin(), bounded.end(), [&coin_ints](int a, int b) { return coin_ints[a].start_pt() < coin_ints[b].start_pt(); });
+        std::vector<double> starts(bounded.size()), max_ends(bounded.size());
+        for(int i = 0; i < bounded.size(); ++i) {
+            starts[i] = coin_ints[bounded[i]].start_pt();
+            max_ends[i] = i > 0 ? D3_max(max_ends[i - 1], coin_ints[bounded[i]].end_pt()) : coin_ints[bounded[i]].end_pt();
+        }
+        auto in_coin = [&](double param) {
+            for(int i: unbounded) {
+                if(param << coin_ints[i]) {
+                    return true;
+                }
+            }
+            int k = static_cast<int>(std::upper_bound(starts.begin(), starts.end(), param + SPAresabs) - starts.begin());
+            for(--k; k >= 0 && max_ends[k] >= param - SPAresabs; --k) {
+                if(param << coin_ints[bounded[k]]) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
         // 剔除重合段范围内的交点
         curve_curve_int *end = nullptr, *head = nullptr, *tmp = nullptr;
         end = head = ZeroInter;
-        int has_delete = 0;
         while(inters) {
-            has_delete = FALSE;
-            for(i = 0; i < coin_ints.size(); ++i) {
-                if(inters->param1 << coin_ints[i]) {  // 销毁交点
-                    tmp = inters;
-                    inters = inters->next;
-                    ACIS_DELETE tmp;
-                    has_delete = TRUE;
-                    break;
-                }
-            }
-            if(!has_delete) {
+            if(in_coin(inters->param1)) {  // 销毁交点
+                tmp = inters;
+                inters = inters->next;
+                cci_delete_inter(tmp);
+            } else {
                 end->next = inters;
                 end = end->next;
                 inters = inters->next;
@@ -1384,7 +1703,7 @@ curve_curve_int* delete_coin(curve_curve_int* inters, std::vector<SPAinterval> c
         }
         end->next = nullptr;
         inters = head->next;
-        ACIS_DELETE head;
+        cci_delete_inter(head);
     }
     return inters;
 }
@@ -1688,14 +2007,14 @@ curve_curve_int* coplanar_ellipse_planar_helix_int(ellipse const& _ell, helix co
         double param2 = t[i];
         SPAposition int_point = h.eval_position(param2);
         double param1 = refine_param(ell.param(int_point), SPAresabs);
-        end->next = ACIS_NEW curve_curve_int(nullptr, int_point, param1, param2);
+        end->next = cci_new_inter(nullptr, int_point, param1, param2);
         end = end->next;
     }
     end->next = nullptr;
     curve_curve_int* ret = head->next;
 
     // 销毁数据
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     ACIS_DELETE[] STD_CAST t;
     if(law_string) {
         law_string->remove();
@@ -2119,7 +2438,7 @@ curve_curve_int* cone_helix_bs3_int(cone const& c, helix const& h, intcurve* ic)
                 }
 
                 ret = tmp->next;
-                ACIS_DELETE tmp;
+                cci_delete_inter(tmp);
                 tmp = ret;
             }
         }
@@ -2127,14 +2446,14 @@ curve_curve_int* cone_helix_bs3_int(cone const& c, helix const& h, intcurve* ic)
     SPAposition apex = c.get_apex();
     // @todo: test_point_tol函数未解耦：耗时过长暂不解耦
     if(h.test_point_tol(apex, SPAresabs) && ic->test_point_tol(apex, SPAresabs)) {
-        end->next = ACIS_NEW curve_curve_int(nullptr, apex, 0.0, 0.0);
+        end->next = cci_new_inter(nullptr, apex, 0.0, 0.0);
         end->next->low_rel = end->next->high_rel = curve_curve_rel::cur_cur_unknown;
         end = end->next;
     }
     end->next = nullptr;
     ret = head->next;
 
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     ACIS_DELETE bs3_cone_ic;
     // bs3_ic->set_cur(nullptr, -1, FALSE);
     // ACIS_DELETE ic;
@@ -2359,6 +2678,7 @@ void lines_of_rect(const plane& pln, int& num_lines, straight*& lines) {
 SPAinterval* line_in_box(straight const& str, SPAbox const& _box, double margin) {
     SPAbox box = enlarge_box(_box, margin);
     // @todo: bound耗时过长暂不解耦
+    CCI_STAT_INC(bound_calls);
     if(str.bound(box).empty()) {
         // 直线不在box内
         return nullptr;
@@ -2474,12 +2794,12 @@ SPAinterval* line_in_rect(straight const& str, plane const& pln) {
                 end = end->next;
                 inter_num++;
             } else {
-                delete_curve_curve_ints(tmp);
+                cci_delete_inters(tmp);
             }
         }
     }
     if(coin) {
-        delete_curve_curve_ints(head);
+        cci_delete_inters(head);
     } else {
         inter_num = CurvCurvIntPointReduce(head->next);
         if(inter_num == 2) {
@@ -2495,7 +2815,7 @@ SPAinterval* line_in_rect(straight const& str, plane const& pln) {
                 ret = ACIS_NEW SPAinterval(interval_type::interval_finite_above, param);
             }
         }
-        delete_curve_curve_ints(head);
+        cci_delete_inters(head);
     }
     ACIS_DELETE[] param_lines;
     return ret;
@@ -2524,14 +2844,14 @@ curve_curve_int* points_in_box(curve_curve_int* inters, SPAbox const& box) {
                     inters = inters->next;
                 } else {
                     tmp = inters->next;
-                    ACIS_DELETE inters;
+                    cci_delete_inter(inters);
                     inters = tmp;
                 }
             }
         }
         end->next = nullptr;
         inters = head->next;
-        ACIS_DELETE head;
+        cci_delete_inter(head);
     }
     return inters;
 }
@@ -2697,7 +3017,7 @@ curve_curve_int* filter_normal_inters(curve_curve_int* inters, curve const& cur1
                 end = end->next;
             } else {
                 curve_curve_int* next = inters->next;
-                ACIS_DELETE inters;
+                cci_delete_inter(inters);
                 inters = next;
                 continue;
             }
@@ -2706,7 +3026,7 @@ curve_curve_int* filter_normal_inters(curve_curve_int* inters, curve const& cur1
     }
     end->next = nullptr;
     inters = head->next;
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     return inters;
 }
 
@@ -2751,7 +3071,7 @@ curve_curve_int* filter_normal_inters(curve_curve_int* inters, std::vector<SPAin
                 end = end->next;
             } else {
                 curve_curve_int* next = inters->next;
-                ACIS_DELETE inters;
+                cci_delete_inter(inters);
                 inters = next;
                 continue;
             }
@@ -2760,7 +3080,7 @@ curve_curve_int* filter_normal_inters(curve_curve_int* inters, std::vector<SPAin
     }
     end->next = nullptr;
     inters = head->next;
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     return inters;
 }
 
@@ -2848,8 +3168,8 @@ curve_curve_int* filter_coins(curve const& cur1, curve const& cur2, std::vector<
         for(auto coins_tmp = coins; coins_tmp; coins_tmp = coins_tmp->next) {
             if(coins_tmp->next && coins_tmp->next->next && fabs(coins_tmp->next->param1 - coins_tmp->next->next->param1) <= SPAresabs) {
                 auto next = coins_tmp->next->next->next;
-                ACIS_DELETE coins_tmp->next->next;
-                ACIS_DELETE coins_tmp->next;
+                cci_delete_inter(coins_tmp->next->next);
+                cci_delete_inter(coins_tmp->next);
                 coins_tmp->next = next;
             }
         }
@@ -2975,8 +3295,8 @@ curve_curve_int* filter_coins_ellipse_ellipse(curve const& cur1, curve const& cu
         for(auto coins_tmp = coins; coins_tmp; coins_tmp = coins_tmp->next) {
             if(coins_tmp->next && coins_tmp->next->next && fabs(coins_tmp->next->param1 - coins_tmp->next->next->param1) <= SPAresabs) {
                 auto next = coins_tmp->next->next->next;
-                ACIS_DELETE coins_tmp->next->next;
-                ACIS_DELETE coins_tmp->next;
+                cci_delete_inter(coins_tmp->next->next);
+                cci_delete_inter(coins_tmp->next);
                 coins_tmp->next = next;
             }
         }
@@ -3029,15 +3349,15 @@ int merge_coin_inters(std::vector<std::pair<curve_curve_int*, curve_curve_int*>>
         for(j = i + 1; j < inters_list.size(); ++j) {
             double s2 = inters_list[j].first->param1, e2 = inters_list[j].second->param1;
             if(e2 - e1 <= tol) {  // e2 <= e1
-                ACIS_DELETE inters_list[j].first;
-                ACIS_DELETE inters_list[j].second;
+                cci_delete_inter(inters_list[j].first);
+                cci_delete_inter(inters_list[j].second);
                 inters_list[j].first = inters_list[j].second = nullptr;
                 num_segs--;
             } else if(s2 - e1 > tol) {  // s2 > e1
                 break;
             } else {  // 合并 第i段和第j段
-                ACIS_DELETE inters_list[i].second;
-                ACIS_DELETE inters_list[j].first;
+                cci_delete_inter(inters_list[i].second);
+                cci_delete_inter(inters_list[j].first);
                 inters_list[i].second = inters_list[j].second;
                 inters_list[j].first = inters_list[j].second = nullptr;
                 e1 = inters_list[i].second->param1;
@@ -3101,6 +3421,7 @@ void LineLineNearInters(straight line1, straight line2, SPAposition& comp1, SPAp
  * @param total_iter_num 最大迭代次数
  */
 void maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, curve_curve_int*& refined_result, int total_iter_num) {
+    CCI_STAT_TIMER(refine);
     // 用MAF方法求精确交点
     int inter_num = 0;                          // inter_num 精确交点个数
     curve_curve_int *inters_end, *inters_head;  // inters_end 返回交点链表尾节点,inters_head 返回交点链表头节点
@@ -3213,6 +3534,7 @@ void maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, cur
             near_result->param2 += dt2;
             // 在切线方向上改变参数值，使得两个近似交点距离更近
             iter_num++;
+            CCI_STAT_INC(refine_iters);
         }
         if(iter_num < total_iter_num) {
             if(debug) {
@@ -3240,7 +3562,7 @@ void maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, cur
         } else {
             // 销毁 迭代失败的交点结果
             tmp = near_result->next;
-            ACIS_DELETE near_result;
+            cci_delete_inter(near_result);
             near_result = tmp;
         }
     }
@@ -3250,7 +3572,7 @@ void maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, cur
         inter_num = CurvCurvIntPointReduce(inters_head->next);
     }
     refined_result = inters_head->next;
-    ACIS_DELETE inters_head;
+    cci_delete_inter(inters_head);
 }
 
 /**
@@ -3334,20 +3656,140 @@ double SPL_BezcHeightEstimate(bs3_curve bs3) {
     return maxdist;
 }
 
+static std::atomic<int> cci_refine_min_seeds{0};           // 并行求精的最少近似交点个数，0为关闭
+static thread_local bool cci_in_refine_worker = false;  // 当前线程是否正在执行并行求精任务
+
+void cci_set_parallel_refine(int min_seeds) {
+    cci_refine_min_seeds = std::max(min_seeds, 0);
+}
+
+int cci_parallel_refine_min_seeds() {
+    return cci_refine_min_seeds;
+}
+
 /**
- * @brief 封装MAF方法，对近似交点结果near_result迭代求精(GME版本)
+ * @brief 并行求精的工作队列，每个工作线程循环领取下标直到所有任务完成
+ */
+class CciRefineWork : public thread_work_base {
+    std::function<void(int)> const& task;
+    int n;
+    std::atomic<int> next{0};
+    std::atomic<err_mess_type> error{0};  // 第一个出错任务的错误号，0表示没有出错
+    modeler_state state;                  // 调用线程的容差和选项，工作线程开始时激活
+
+  public:
+    CciRefineWork(std::function<void(int)> const& _task, int _n): task(_task), n(_n) {}
+
+    err_mess_type error_number() const { return error; }
+
+  protected:
+    void process(void*) override {
+        state.activate();
+        cci_in_refine_worker = true;
+        for(int k = next++; k < n; k = next++) {
+            // ACIS错误不能跨线程抛出，记录第一个错误号后停止领取任务，由调用线程重新抛出
+            API_BEGIN
+            task(k);
+            API_END
+            if(!result.ok()) {
+                err_mess_type expected = 0;
+                error.compare_exchange_strong(expected, result.error_number());
+                next = n;
+                break;
+            }
+        }
+        cci_in_refine_worker = false;
+    }
+};
+
+bool cci_parallel_refine(int n, std::function<void(int)> const& task) {
+    int min_seeds = cci_refine_min_seeds;
+    if(min_seeds <= 0 || n < min_seeds || cci_in_refine_worker) {
+        return false;
+    }
+    int num_threads = thread_work_base::thread_count();
+    if(num_threads <= 0) {
+        return false;
+    }
+    CciRefineWork work(task, n);
+    for(int i = 0; i < std::min(num_threads, n); ++i) {
+        work.run(nullptr);
+    }
+    work.sync();
+    if(work.error_number()) {
+        sys_error(work.error_number());
+    }
+    return true;
+}
+
+/**
+ * @brief MAF第一次迭代在近似交点处的位置和切向量，由批量求值器得到，valid[k]为false时第k条曲线逐点求值
+ */
+struct CciMafSeedStart {
+    bool valid[2] = {false, false};
+    SPAposition pos[2];
+    SPAvector deriv[2];
+};
+
+/**
+ * @brief 精确样条曲线(exact_int_cur)在各近似交点参数处的位置和切向量批量求值，写入starts的第k项
+ *        参数按MAF迭代的方式限制在曲线参数范围内；其余类型的曲线不处理，由MAF逐点求值
+ */
+static void cci_maf_seed_starts(curve const& cur, int k, SPAinterval const& range, std::vector<curve_curve_int*> const& seeds, std::vector<CciMafSeedStart>& starts) {
+    if(cur.type() != intcurve_type || static_cast<intcurve const&>(cur).get_int_cur().type() != exactcur_type) {
+        return;
+    }
+    CciPreparedData const* data = cci_prepared_data(cur);
+    bool prepared = data && data->beziers_valid;
+    // 没有预处理的Bezier曲线段时，分解曲线的开销只在近似交点足够多时才值得
+    if(!prepared && static_cast<int>(seeds.size()) < CCI_EVAL_LANES) {
+        return;
+    }
+    std::vector<double> params;
+    params.reserve(seeds.size());
+    for(curve_curve_int const* seed: seeds) {
+        double t = k == 0 ? seed->param1 : seed->param2;
+        if(t > range) t = range.end_pt();
+        if(t < range) t = range.start_pt();
+        params.push_back(t);
+    }
+    CciBs3Evaluator evaluator;
+    bs3_curve bs3 = nullptr;
+    if(prepared) {
+        evaluator.init(data->beziers);
+    } else {
+        bs3 = cci_intcurve_bs3(static_cast<intcurve const&>(cur));
+        if(!bs3) {
+            return;
+        }
+        evaluator.init(bs3);
+    }
+    std::vector<SPAposition> pos(params.size());
+    std::vector<SPAvector> deriv(params.size());
+    evaluator.eval(static_cast<int>(params.size()), params.data(), pos.data(), deriv.data());
+    bs3_curve_delete(bs3);
+    for(size_t i = 0; i < seeds.size(); ++i) {
+        starts[i].valid[k] = true;
+        starts[i].pos[k] = pos[i];
+        starts[i].deriv[k] = deriv[i];
+    }
+}
+
+/**
+ * @brief MAF方法对单个近似交点迭代求精，只读取两条曲线，可在工作线程中调用
  * @param cur1 曲线1
  * @param cur2 曲线2
- * @param near_result 近似交点结果
- * @param refined_result 求精后的交点结果
+ * @param near_result 近似交点，求精后的参数写回其中
+ * @param param_range_cur1 曲线1的参数范围
+ * @param param_range_cur2 曲线2的参数范围
  * @param total_iter_num 最大迭代次数
  * @param quadratic_approximation 是否使用二次近似
+ * @param dis_tol 收敛的距离容差
+ * @param start 第一次迭代的批量求值结果
+ * @param result 求精结果
  */
-void curve_curve_maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, curve_curve_int*& refined_result, int total_iter_num, logical quadratic_approximation) {
-    // 用MAF方法求精确交点
-    int inter_num = 0;  // inter_num 精确交点个数
-    curve_curve_int* inters = nullptr;
-
+static void cci_maf_refine_seed(curve const& cur1, curve const& cur2, curve_curve_int* near_result, SPAinterval const& param_range_cur1, SPAinterval const& param_range_cur2, int total_iter_num, logical quadratic_approximation, double dis_tol, CciMafSeedStart const& start,
+                                CciMafSeedResult& result) {
     double dt1 = NAN, dt2 = NAN;  // MAF迭代过程中两个曲线的参数增量
     SPAvector cv1, cv2;           // cv1是cur1在近似交点处的的切线方向；cv2是cur2在近似交点处的的切线方向
     SPAposition cp1, cp2, comp1, comp2;
@@ -3357,6 +3799,236 @@ void curve_curve_maf(curve const& cur1, curve const& cur2, curve_curve_int* near
     // 见函数LineLineNearInters()
 
     straight line1, line2;  // cur1上近似交点处的切线，cur2上近似交点处的切线
+    // 相切时对曲线的坐标变换和拉伸只作用于求值包装，不拷贝曲线
+    CciCurveView curve1(cur1), curve2(cur2);
+
+    double cand_param1, cand_param2;
+    double cand_dis = DBL_MAX;
+    logical cand_point = FALSE;  // 候选的交点，防止超出迭代出错漏交点的情况，作为一种情况补充
+
+    int iter_num = 0;  // MAF算法迭代次数
+
+    double last_dt1 = NAN, last_dt2 = NAN;
+
+    double true_param1 = 1.5707963391310085, true_param2 = 0.49999999383194521;
+
+    while(iter_num < total_iter_num) {
+        // 判断param与曲线参数范围的大小关系
+        if(near_result->param1 > param_range_cur1) near_result->param1 = param_range_cur1.end_pt();
+        if(near_result->param1 < param_range_cur1) near_result->param1 = param_range_cur1.start_pt();
+        if(near_result->param2 > param_range_cur2) near_result->param2 = param_range_cur2.end_pt();
+        if(near_result->param2 < param_range_cur2) near_result->param2 = param_range_cur2.start_pt();
+
+        // printf("%d, param1: %.16lf, param2: %.16lf, dt1: %.16lf, dt2: %.16lf\n", iter_num, near_result->param1, near_result->param2, dt1, dt2);
+        // printf("%d, param1_dis: %.16lf, param2_dis: %.16lf, dt1: %.16lf, dt2: %.16lf\n", iter_num, true_param1 - near_result->param1, true_param2 - near_result->param2, dt1, dt2);
+
+        // cp1在cur1上的近似交点，cp2在cur2上的近似交点；cv1、cv2为近似交点处的切向量
+        // 第一次迭代时曲线未经变换，直接使用批量求值的结果
+        if(iter_num == 0 && start.valid[0]) {
+            cp1 = start.pos[0];
+            cv1 = start.deriv[0];
+        } else {
+            // @todo: eval_position 耗时过长暂不解耦
+            cp1 = curve1.eval_position(near_result->param1);  // 待解耦，存在问题
+            cv1 = curve1.eval_deriv(near_result->param1);     // 待解耦，存在问题
+        }
+        if(iter_num == 0 && start.valid[1]) {
+            cp2 = start.pos[1];
+            cv2 = start.deriv[1];
+        } else {
+            cp2 = curve2.eval_position(near_result->param2);  // 待解耦，存在问题
+            cv2 = curve2.eval_deriv(near_result->param2);     // 待解耦，存在问题
+        }
+
+        // if(tan(angle) <= 0.0015) {  // 0.0015
+        //     // 相切求交时，当两个切线的夹角的正切在0.0015内，考虑将这个交点作为候选交点
+        //     // get best 靠最近的一对点
+        //     cand_point = TRUE;
+        //     cand_param1 = near_result->param1;
+        //     cand_param2 = near_result->param2;
+        //     cand_dis = distance_to_point(cp1, cp2);
+        // }
+
+        // if(!isnan(last_dt1) && !isnan(last_dt2)) {
+        //     // 二次近似 迭代过程中震荡的情况处理
+        //     if(fabs(last_dt1 + dt1) <= dis_tol && fabs(last_dt2 + dt2) <= dis_tol) {
+        //         quadratic_approximation = FALSE;
+        //     }
+        // }
+
+        if(!quadratic_approximation) {
+            // @todo: VEC_acute_angle解耦存在中断
+            double angle = VEC_acute_angle(cv1, cv2);       // 曲线在两个近似点处切线的夹角
+            while(angle >= 1e-10 && tan(angle) <= 0.002) {  // 0.002, 0.02, 0.1
+                // 相切求交
+                SPAunit_vector vz = normalise(cv1);
+                SPAunit_vector vx, vy;
+                compute_axes_from_z(vz, vx, vy);
+                curve1.transform(cp1, vx, vy, vz);
+                curve2.transform(cp1, vx, vy, vz);
+
+                // 将x和y方向 拉伸1000倍  注: 拉伸操作会影响求交结果
+                curve1.scale_xy(1000);
+                curve2.scale_xy(1000);
+
+                // 重新计算cp1, cp2, cv1, cv2
+                // @todo: eval_position 耗时过长暂不解耦
+                cp1 = curve1.eval_position(near_result->param1);  // 待解耦，存在问题
+                cp2 = curve2.eval_position(near_result->param2);  // 待解耦，存在问题
+                cv1 = curve1.eval_deriv(near_result->param1);     // 待解耦，存在问题
+                cv2 = curve2.eval_deriv(near_result->param2);     // 待解耦，存在问题
+                angle = VEC_acute_angle(cv1, cv2);                 // 待解耦，接口未实现
+
+                const double MAX_THRESHOLD = 1e16;
+                if(fabs(cp1.x()) >= MAX_THRESHOLD || fabs(cp1.y()) >= MAX_THRESHOLD || fabs(cp1.z()) >= MAX_THRESHOLD) {
+                    // 考虑为浮点数溢出
+                    iter_num = total_iter_num;
+                    break;
+                }
+            }
+        }
+
+        // cv1是cur1在近似交点处的的切线方向；cv2是cur2在近似交点处的的切线方向
+        // 目前测试 仍然需要设置cp1和cp2的距离小于1e-6*1e-6，不然会提前跳出
+        if(distance_to_point(cp1, cp2) < dis_tol) {  // 达到精度要求
+            break;
+        }
+
+        last_dt1 = dt1, last_dt2 = dt2;
+        logical quadratic_success = FALSE;
+        if(quadratic_approximation) {
+            bool cand_point_quad = false;
+            quadratic_success = quadratic_approximation_iterate((curve*)&cur1, (curve*)&cur2, near_result->param1, near_result->param2, dt1, dt2, cand_point_quad);
+            // if(quadratic_success && fabs(dt1) <= 1e-16 && fabs(dt2) <= 1e-16) {  // 1.5e-17
+            //     quadratic_success = FALSE;
+            // }
+            if(cand_point_quad) {
+                double dis_cp1_cp2 = distance_to_point(cp1, cp2);
+                if(!cand_point || dis_cp1_cp2 < cand_dis) {
+                    cand_point = TRUE;
+                    cand_param1 = near_result->param1;
+                    cand_param2 = near_result->param2;
+                    cand_dis = dis_cp1_cp2;
+                }
+            }
+        }
+        if(!quadratic_success) {
+            // 构造cur1在cp1处,cur2在cp2处的两条切线line1, line2
+            line1.root_point = cp1;
+            line1.direction = normalise(cv1);
+            line2.root_point = cp2;
+            line2.direction = normalise(cv2);
+
+            LineLineNearInters(line1, line2, comp1, comp2);
+
+            // comp1和comp2为分别为line1和line2上一对最近的点
+            dt1 = line1.param(comp1) / cv1.len();
+            dt2 = line2.param(comp2) / cv2.len();
+        }
+
+        // 判断dt1和dt2是否足够小
+        if(fabs(dt1) <= SPAresabs * SPAresabs && fabs(dt2) <= SPAresabs * SPAresabs) {
+            if(distance_to_point(cp1, cp2) <= SPAresabs) {
+                // 若此时cp1和cp2已经足够接近，可认为已经收敛
+                break;
+            }
+        }
+
+        near_result->param1 += dt1;
+        near_result->param2 += dt2;
+        // 在切线方向上改变参数值，使得两个近似交点距离更近
+        iter_num++;
+        CCI_STAT_INC(refine_iters);
+    }
+    logical finished = FALSE;
+    if(iter_num < total_iter_num) {
+        finished = TRUE;
+    } else if(cand_point) {
+        // @todo: eval_position 耗时过长暂不解耦
+        SPAposition cp1 = cur1.eval_position(cand_param1);
+        SPAposition cp2 = cur2.eval_position(cand_param2);
+        SPAposition int_point = mid_point(cp1, cp2);
+        // @todo: test_point_tol函数未解耦：暂不解耦
+        if(cur2.test_point_tol(cp1) && cur1.test_point_tol(cp2) && cur1.test_point_tol(int_point) && cur2.test_point_tol(int_point)) {  // @todo: 存在内存泄漏 运行时间较长
+            finished = TRUE;
+            near_result->param1 = cand_param1;
+            near_result->param2 = cand_param2;
+        }
+    }
+    result.finished = finished;
+    if(finished) {
+        // @todo: eval_position 耗时过长暂不解耦
+        cp1 = cur1.eval_position(near_result->param1);   // 待解耦，存在问题
+        cp2 = cur2.eval_position(near_result->param2);   // 待解耦，存在问题
+        cv1 = cur1.eval_direction(near_result->param1);  // 待解耦，存在问题
+        cv2 = cur2.eval_direction(near_result->param2);  // 待解耦，存在问题
+
+        result.int_point = mid_point(cp1, cp2);  // 求中点
+        // double angle = VEC_acute_angle(cv1, cv2);
+        result.tangent = biparallel(cv1, cv2);
+        result.distance = distance_to_point(cp1, cp2);
+    }
+
+}
+
+// 当前线程的存在性查询，由CciExistenceScope设置
+static thread_local CciExistenceScope* cci_current_existence = nullptr;
+
+CciExistenceScope::CciExistenceScope(curve const& c1, curve const& c2, SPAbox const& box): curves{&c1, &c2}, box(&box), previous(cci_current_existence) {
+    cci_current_existence = this;
+}
+
+CciExistenceScope::~CciExistenceScope() {
+    cci_current_existence = previous;
+}
+
+bool cci_existence_query() {
+    return cci_current_existence != nullptr;
+}
+
+bool cci_existence_accepts(curve const& cur1, curve const& cur2, SPAposition const& point, double param1, double param2) {
+    if(!cci_current_existence) {
+        return false;
+    }
+    if(&cur1 == cci_current_existence->curves[1] && &cur2 == cci_current_existence->curves[0]) {
+        std::swap(param1, param2);
+    }
+    // 与answer_int_cur_cur中filter_normal_inters、points_in_box的判断一致
+    curve const& c1 = *cci_current_existence->curves[0];
+    curve const& c2 = *cci_current_existence->curves[1];
+    find_valid_param(c1, param1, c1.param_range());
+    find_valid_param(c2, param2, c2.param_range());
+    if(!(param1 << c1.param_range()) || !(param2 << c2.param_range())) {
+        return false;
+    }
+    SPAbox const& box = *cci_current_existence->box;
+    return !&box || point << box;
+}
+
+bool cci_existence_found(curve const& cur1, curve const& cur2, curve_curve_int const* inters) {
+    for(; inters; inters = inters->next) {
+        if(inters->low_rel == curve_curve_rel::cur_cur_coin || inters->high_rel == curve_curve_rel::cur_cur_coin || cci_existence_accepts(cur1, cur2, inters->int_point, inters->param1, inters->param2)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief 封装MAF方法，对近似交点结果near_result迭代求精(GME版本)
+ * @param cur1 曲线1
+ * @param cur2 曲线2
+ * @param near_result 近似交点结果
+ * @param refined_result 求精后的交点结果
+ * @param total_iter_num 最大迭代次数
+ * @param quadratic_approximation 是否使用二次近似
+ */
+void curve_curve_maf(curve const& cur1, curve const& cur2, curve_curve_int* near_result, curve_curve_int*& refined_result, int total_iter_num, logical quadratic_approximation) {
+    CCI_STAT_TIMER(refine);
+    // 用MAF方法求精确交点
+    int inter_num = 0;  // inter_num 精确交点个数
+    curve_curve_int* inters = nullptr;
+
     // SPAinterval param_range_cur1(interval_type::interval_infinite);  // cur1的参数范围
     // SPAinterval param_range_cur2(interval_type::interval_infinite);  // cur2的参数范围
     // if(cur1.type() == intcurve_type && !cur1.periodic()) {              // intcurve
@@ -3385,216 +4057,70 @@ void curve_curve_maf(curve const& cur1, curve const& cur2, curve_curve_int* near
     // }
     SPAinterval param_range_cur1 = curve1->param_range();
     SPAinterval param_range_cur2 = curve2->param_range();
-    bool linear_cur1 = cur1.type() == straight_type || (cur1.type() == intcurve_type && SPL_BezcHeightEstimate(((intcurve*)&cur1)->cur()) <= SPAresabs);
-    bool linear_cur2 = cur2.type() == straight_type || (cur2.type() == intcurve_type && SPL_BezcHeightEstimate(((intcurve*)&cur2)->cur()) <= SPAresabs);
+    CciPreparedData const* data1 = cci_prepared_data(cur1);
+    CciPreparedData const* data2 = cci_prepared_data(cur2);
+    bool linear_cur1 = cur1.type() == straight_type || (cur1.type() == intcurve_type && (data1 ? data1->linear : SPL_BezcHeightEstimate(((intcurve*)&cur1)->cur()) <= SPAresabs));
+    bool linear_cur2 = cur2.type() == straight_type || (cur2.type() == intcurve_type && (data2 ? data2->linear : SPL_BezcHeightEstimate(((intcurve*)&cur2)->cur()) <= SPAresabs));
     if(linear_cur1 && linear_cur2) {
         quadratic_approximation = FALSE;
     }
     double tol = SPAresabs / 10;  // 要求参数距离在1e-7以内
     int degree = std::max(curve_degree(cur1), curve_degree(cur2));
     double dis_tol = pow(tol, degree);
-    std::vector<std::pair<double, curve_curve_int*>> cci_vec;  // distance : inters
-    while(near_result) {
-        if(!quadratic_approximation) {
-            // 对于每个近似交点，用于拉伸的曲线需要重新拷贝
-            curve1 = cur1.copy_curve();  // make a copy of curve
-            curve2 = cur2.copy_curve();
+    // 各近似交点互相独立，求精结果按近似交点的顺序存放，保证串行和并行求精的结果一致
+    std::vector<curve_curve_int*> seeds;
+    for(curve_curve_int* seed = near_result; seed; seed = seed->next) {
+        seeds.push_back(seed);
+    }
+    // 各近似交点处第一次迭代的求值批量完成
+    std::vector<CciMafSeedStart> starts(seeds.size());
+    cci_maf_seed_starts(cur1, 0, param_range_cur1, seeds, starts);
+    cci_maf_seed_starts(cur2, 1, param_range_cur2, seeds, starts);
+    std::vector<CciMafSeedResult> seed_results(seeds.size());
+    auto refine = [&](int k) { cci_maf_refine_seed(cur1, cur2, seeds[k], param_range_cur1, param_range_cur2, total_iter_num, quadratic_approximation, dis_tol, starts[k], seed_results[k]); };
+    bool existence = cci_existence_query();
+    if(existence || !cci_parallel_refine(static_cast<int>(seeds.size()), refine)) {
+        for(int k = 0; k < static_cast<int>(seeds.size()); ++k) {
+            refine(k);
+            // 只判断是否存在交点时，得到第一个满足要求的交点后不再求精其余近似交点
+            if(existence && seed_results[k].finished && cci_existence_accepts(cur1, cur2, seed_results[k].int_point, seeds[k]->param1, seeds[k]->param2)) {
+                break;
+            }
         }
+    }
 
-        double cand_param1, cand_param2;
-        double cand_dis = DBL_MAX;
-        logical cand_point = FALSE;  // 候选的交点，防止超出迭代出错漏交点的情况，作为一种情况补充
+    std::vector<std::pair<double, int>> cci_vec;  // distance : seed index
+    for(int k = 0; k < static_cast<int>(seeds.size()); ++k) {
+        if(seed_results[k].finished) {
+            cci_vec.push_back(std::make_pair(seed_results[k].distance, k));
+        }
+    }
+    // if(cur1.subsetted()) {
+    //     ACIS_DELETE curve1;
+    //     curve1 = nullptr;
+    // }
+    // if(cur2.subsetted()) {
+    //     ACIS_DELETE curve2;
+    //     curve2 = nullptr;
+    // }
+    //  按照distance的非递减序对cci_vec排序
+    sort(cci_vec.begin(), cci_vec.end());
+    inters = nullptr;
+    for(int i = cci_vec.size() - 1; i >= 0; --i) {
+        CciMafSeedResult const& seed_result = seed_results[cci_vec[i].second];
+        curve_curve_int const* seed = seeds[cci_vec[i].second];
+        inters = cci_new_inter(inters, seed_result.int_point, seed->param1, seed->param2);
+        inters->low_rel = inters->high_rel = seed_result.tangent ? curve_curve_rel::cur_cur_tangent : curve_curve_rel::cur_cur_normal;
+    }
 
-        int iter_num = 0;  // MAF算法迭代次数
+    // 额外判断曲线端点，因为MAF不能很好地处理曲线端点处的交点
+    inters = connect_curve_curve_int(inters, judge_curve_ends(cur1, cur2));
 
-        double last_dt1 = NAN, last_dt2 = NAN;
+    // 交点去重
+    inter_num = CurvCurvIntPointReduce(inters);
 
-        double true_param1 = 1.5707963391310085, true_param2 = 0.49999999383194521;
-
-        while(iter_num < total_iter_num) {
-            // 判断param与曲线参数范围的大小关系
-            if(near_result->param1 > param_range_cur1) near_result->param1 = param_range_cur1.end_pt();
-            if(near_result->param1 < param_range_cur1) near_result->param1 = param_range_cur1.start_pt();
-            if(near_result->param2 > param_range_cur2) near_result->param2 = param_range_cur2.end_pt();
-            if(near_result->param2 < param_range_cur2) near_result->param2 = param_range_cur2.start_pt();
-
-            // printf("%d, param1: %.16lf, param2: %.16lf, dt1: %.16lf, dt2: %.16lf\n", iter_num, near_result->param1, near_result->param2, dt1, dt2);
-            // printf("%d, param1_dis: %.16lf, param2_dis: %.16lf, dt1: %.16lf, dt2: %.16lf\n", iter_num, true_param1 - near_result->param1, true_param2 - near_result->param2, dt1, dt2);
-
-            // cp1在cur1上的近似交点，cp2在cur2上的近似交点
-            // @todo: eval_position 耗时过长暂不解耦
-            cp1 = curve1->eval_position(near_result->param1);  // 待解耦，存在问题
-            cp2 = curve2->eval_position(near_result->param2);  // 待解耦，存在问题
-
-            // cv1在cur1上的近似交点处的切向量，cv2在cur2上的近似交点处的切向量
-            cv1 = curve1->eval_deriv(near_result->param1);  // 待解耦，存在问题
-            cv2 = curve2->eval_deriv(near_result->param2);  // 待解耦，存在问题
-
-            // if(tan(angle) <= 0.0015) {  // 0.0015
-            //     // 相切求交时，当两个切线的夹角的正切在0.0015内，考虑将这个交点作为候选交点
-            //     // get best 靠最近的一对点
-            //     cand_point = TRUE;
-            //     cand_param1 = near_result->param1;
-            //     cand_param2 = near_result->param2;
-            //     cand_dis = distance_to_point(cp1, cp2);
-            // }
-
-            // if(!isnan(last_dt1) && !isnan(last_dt2)) {
-            //     // 二次近似 迭代过程中震荡的情况处理
-            //     if(fabs(last_dt1 + dt1) <= dis_tol && fabs(last_dt2 + dt2) <= dis_tol) {
-            //         quadratic_approximation = FALSE;
-            //     }
-            // }
-
-            if(!quadratic_approximation) {
-                // @todo: VEC_acute_angle解耦存在中断
-                double angle = VEC_acute_angle(cv1, cv2);       // 曲线在两个近似点处切线的夹角
-                while(angle >= 1e-10 && tan(angle) <= 0.002) {  // 0.002, 0.02, 0.1
-                    // 相切求交
-                    SPAunit_vector vz = normalise(cv1);
-                    SPAunit_vector vx, vy;
-                    compute_axes_from_z(vz, vx, vy);
-                    transf_curve(curve1, cp1, vx, vy, vz);
-                    transf_curve(curve2, cp1, vx, vy, vz);
-
-                    // 将x和y方向 拉伸1000倍  注: 拉伸操作会影响求交结果
-                    extend_curve(curve1, 1000);
-                    extend_curve(curve2, 1000);
-
-                    // 重新计算cp1, cp2, cv1, cv2
-                    // @todo: eval_position 耗时过长暂不解耦
-                    cp1 = curve1->eval_position(near_result->param1);  // 待解耦，存在问题
-                    cp2 = curve2->eval_position(near_result->param2);  // 待解耦，存在问题
-                    cv1 = curve1->eval_deriv(near_result->param1);     // 待解耦，存在问题
-                    cv2 = curve2->eval_deriv(near_result->param2);     // 待解耦，存在问题
-                    angle = VEC_acute_angle(cv1, cv2);                 // 待解耦，接口未实现
-
-                    const double MAX_THRESHOLD = 1e16;
-                    if(fabs(cp1.x()) >= MAX_THRESHOLD || fabs(cp1.y()) >= MAX_THRESHOLD || fabs(cp1.z()) >= MAX_THRESHOLD) {
-                        // 考虑为浮点数溢出
-                        iter_num = total_iter_num;
-                        break;
-                    }
-                }
-            }
-
-            // cv1是cur1在近似交点处的的切线方向；cv2是cur2在近似交点处的的切线方向
-            // 目前测试 仍然需要设置cp1和cp2的距离小于1e-6*1e-6，不然会提前跳出
-            if(distance_to_point(cp1, cp2) < dis_tol) {  // 达到精度要求
-                break;
-            }
-
-            last_dt1 = dt1, last_dt2 = dt2;
-            logical quadratic_success = FALSE;
-            if(quadratic_approximation) {
-                bool cand_point_quad = false;
-                quadratic_success = quadratic_approximation_iterate(curve1, curve2, near_result->param1, near_result->param2, dt1, dt2, cand_point_quad);
-                // if(quadratic_success && fabs(dt1) <= 1e-16 && fabs(dt2) <= 1e-16) {  // 1.5e-17
-                //     quadratic_success = FALSE;
-                // }
-                if(cand_point_quad) {
-                    double dis_cp1_cp2 = distance_to_point(cp1, cp2);
-                    if(!cand_point || dis_cp1_cp2 < cand_dis) {
-                        cand_point = TRUE;
-                        cand_param1 = near_result->param1;
-                        cand_param2 = near_result->param2;
-                        cand_dis = dis_cp1_cp2;
-                    }
-                }
-            }
-            if(!quadratic_success) {
-                // 构造cur1在cp1处,cur2在cp2处的两条切线line1, line2
-                line1.root_point = cp1;
-                line1.direction = normalise(cv1);
-                line2.root_point = cp2;
-                line2.direction = normalise(cv2);
-
-                LineLineNearInters(line1, line2, comp1, comp2);
-
-                // comp1和comp2为分别为line1和line2上一对最近的点
-                dt1 = line1.param(comp1) / cv1.len();
-                dt2 = line2.param(comp2) / cv2.len();
-            }
-
-            // 判断dt1和dt2是否足够小
-            if(fabs(dt1) <= SPAresabs * SPAresabs && fabs(dt2) <= SPAresabs * SPAresabs) {
-                if(distance_to_point(cp1, cp2) <= SPAresabs) {
-                    // 若此时cp1和cp2已经足够接近，可认为已经收敛
-                    break;
-                }
-            }
-
-            near_result->param1 += dt1;
-            near_result->param2 += dt2;
-            // 在切线方向上改变参数值，使得两个近似交点距离更近
-            iter_num++;
-        }
-        logical finished = FALSE;
-        if(iter_num < total_iter_num) {
-            finished = TRUE;
-        } else if(cand_point) {
-            // @todo: eval_position 耗时过长暂不解耦
-            SPAposition cp1 = cur1.eval_position(cand_param1);
-            SPAposition cp2 = cur2.eval_position(cand_param2);
-            SPAposition int_point = mid_point(cp1, cp2);
-            // @todo: test_point_tol函数未解耦：暂不解耦
-            if(cur2.test_point_tol(cp1) && cur1.test_point_tol(cp2) && cur1.test_point_tol(int_point) && cur2.test_point_tol(int_point)) {  // @todo: 存在内存泄漏 运行时间较长
-                finished = TRUE;
-                near_result->param1 = cand_param1;
-                near_result->param2 = cand_param2;
-            }
-        }
-        if(finished) {
-            // @todo: eval_position 耗时过长暂不解耦
-            cp1 = cur1.eval_position(near_result->param1);   // 待解耦，存在问题
-            cp2 = cur2.eval_position(near_result->param2);   // 待解耦，存在问题
-            cv1 = cur1.eval_direction(near_result->param1);  // 待解耦，存在问题
-            cv2 = cur2.eval_direction(near_result->param2);  // 待解耦，存在问题
-
-            SPAposition int_point = mid_point(cp1, cp2);  // 求中点
-
-            inters = ACIS_NEW curve_curve_int(nullptr, int_point, near_result->param1, near_result->param2);
-            // double angle = VEC_acute_angle(cv1, cv2);
-            if(biparallel(cv1, cv2)) {
-                inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_tangent;
-            } else {
-                inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_normal;
-            }
-            cci_vec.push_back(std::make_pair(distance_to_point(cp1, cp2), inters));
-        }
-        // 销毁拷贝后的曲线
-        if(!quadratic_approximation) {
-            ACIS_DELETE curve1;
-            ACIS_DELETE curve2;
-            curve1 = curve2 = nullptr;
-        }
-
-        near_result = near_result->next;
-    }
-    // if(cur1.subsetted()) {
-    //     ACIS_DELETE curve1;
-    //     curve1 = nullptr;
-    // }
-    // if(cur2.subsetted()) {
-    //     ACIS_DELETE curve2;
-    //     curve2 = nullptr;
-    // }
-    //  按照distance的非递减序对cci_vec排序
-    sort(cci_vec.begin(), cci_vec.end());
-    inters = nullptr;
-    for(int i = cci_vec.size() - 1; i >= 0; --i) {
-        cci_vec[i].second->next = inters;
-        inters = cci_vec[i].second;
-    }
-
-    // 额外判断曲线端点，因为MAF不能很好地处理曲线端点处的交点
-    inters = connect_curve_curve_int(inters, judge_curve_ends(cur1, cur2));
-
-    // 交点去重
-    inter_num = CurvCurvIntPointReduce(inters);
-
-    refined_result = inters;
-}
+    refined_result = inters;
+}
 
 /**
  * @brief 获得曲线的degree
@@ -3620,17 +4146,20 @@ int curve_degree(curve const& cur) {
 logical quadratic_approximation_circle_iterate(curve* _curv, ellipse const& cir, double t, SPAposition const& int_point, double& dt) {
     double _dt = 1e8;
     logical success = FALSE;
-    curve* curv = _curv->copy_curve();
-    // 将曲线转化到圆的局部坐标系
+    // 将曲线转化到圆的局部坐标系，只变换求值结果，不拷贝曲线
     SPAtransf transf = std::move(cucuint_coordinate_transf(cir.centre, cir.major_axis, cir.normal * cir.major_axis, cir.normal));
-    (*curv) *= transf;
+    CciCurveView curv(*_curv);
+    curv.transform(cir.centre, cir.major_axis, cir.normal * cir.major_axis, cir.normal);
 
     SPAposition cp;
     SPAvector cv, cvv;
-    curv->eval(t, cp, cv, cvv);
+    curv.eval(t, cp, cv, cvv);
     // ACIS的eval() 二次nurbs，cvv可能得到的值为零向量，EllipseNURBSIntrTest.Degree2Inters1
-    if(is_zero(cvv) && curv->type() == intcurve_type) {
-        bs3_curve_eval(t, ((intcurve*)curv)->cur(), cp, cv, cvv);
+    if(is_zero(cvv) && _curv->type() == intcurve_type) {
+        bs3_curve_eval(t, ((intcurve*)_curv)->cur(), cp, cv, cvv);
+        cp = curv.mat * cp + curv.offset;
+        cv = curv.mat * cv;
+        cvv = curv.mat * cvv;
     }
 
     straight str(int_point * transf, normalise((cir.normal * transf) * cv));
@@ -3641,7 +4170,7 @@ logical quadratic_approximation_circle_iterate(curve* _curv, ellipse const& cir,
     double B = (cv - t * cvv) % str_vec;
     double C = (cp - cv * t + 0.5 * cvv * t * t) % str_vec + D;
     double coef[] = {A, B, C};
-    double* roots = nullptr;
+    double roots[2];
     int num_root = Equatn(2, coef, roots, -1e8, 1e8);
 
     if(num_root == 0) {
@@ -3655,11 +4184,6 @@ logical quadratic_approximation_circle_iterate(curve* _curv, ellipse const& cir,
         }
     }
 
-    //(*curv) *= (transf.inverse());  // restore存在精度问题
-    ACIS_DELETE curv;
-    ACIS_DELETE[] STD_CAST roots;
-    roots = nullptr;
-    curv = nullptr;
     if(success) {
         dt = _dt;
     }
@@ -3826,7 +4350,7 @@ logical quadratic_approximation_iterate(curve* cur1, curve* cur2, double param1,
         //     if(!can_cir2) {
         //         std::swap(_dt1, _dt2);
         //     }
-        //     delete_curve_curve_ints(inters);
+        //     cci_delete_inters(inters);
         // } else {
         //     double t1 = param1, t2 = param2;
         //     if(!can_cir2) {
@@ -3913,6 +4437,70 @@ void extend_curve(curve*& curve1, double extend_magnitude) {
     }
 }
 
+CciCurveView::CciCurveView(curve const& c, CciExtension ext): cur(&c), mat(SPAvector(1, 0, 0), SPAvector(0, 1, 0), SPAvector(0, 0, 1)), offset(0, 0, 0), range(c.param_range()), extension(ext) {
+    if(c.periodic()) {
+        range = SPAinterval(interval_infinite, 0.0, 0.0);  // 周期曲线不需要延拓
+    }
+}
+
+void CciCurveView::transform(SPAposition const& cp, SPAvector const& vx, SPAvector const& vy, SPAvector const& vz) {
+    // 新的位置为M * (mat * p + offset - cp)
+    SPAmatrix m(normalise(vx), normalise(vy), normalise(vz));
+    mat = m * mat;
+    offset = m * (offset - (cp - SPAposition(0, 0, 0)));
+}
+
+void CciCurveView::scale_xy(double extend_magnitude) {
+    SPAmatrix m(SPAvector(extend_magnitude, 0, 0), SPAvector(0, extend_magnitude, 0), SPAvector(0, 0, 1));
+    mat = m * mat;
+    offset = m * offset;
+}
+
+void CciCurveView::eval(double t, SPAposition& pos, SPAvector& d1, SPAvector& d2) const {
+    double t0 = t;  // 参数范围内离t最近的参数
+    if(range.bounded_above() && t > range.end_pt()) {
+        t0 = range.end_pt();
+    } else if(range.bounded_below() && t < range.start_pt()) {
+        t0 = range.start_pt();
+    }
+    SPAposition p;
+    SPAvector v1, v2;
+    cur->eval(t0, p, v1, v2);
+    if(t0 != t) {
+        double h = t - t0;
+        if(extension == CciExtension::linear) {
+            p = p + h * v1;
+            v2 = SPAvector(0, 0, 0);
+        } else {
+            p = p + h * v1 + 0.5 * h * h * v2;
+            v1 = v1 + h * v2;
+        }
+    }
+    pos = mat * p + offset;
+    d1 = mat * v1;
+    d2 = mat * v2;
+}
+
+SPAposition CciCurveView::eval_position(double t) const {
+    if(t << range) {
+        return mat * cur->eval_position(t) + offset;
+    }
+    SPAposition pos;
+    SPAvector d1, d2;
+    eval(t, pos, d1, d2);
+    return pos;
+}
+
+SPAvector CciCurveView::eval_deriv(double t) const {
+    if(t << range) {
+        return mat * cur->eval_deriv(t);
+    }
+    SPAposition pos;
+    SPAvector d1, d2;
+    eval(t, pos, d1, d2);
+    return d1;
+}
+
 // 将curve1转化到 (cp, vx, vy, vz)的局部坐标系中
 void transf_curve(curve*& curve1, SPAposition cp, SPAunit_vector vx, SPAunit_vector vy, SPAunit_vector vz) {
     if(curve1 != nullptr) {
@@ -4226,7 +4814,7 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
     double x2Coef[7], y2Coef[7];  // 平方后的系数,最作为7个系数
     double dxyCoef[7], xyCoef[4];
     int xNum = 0, yNum = 0;
-    double* u;
+    double u[6];  // 方程的根，最多6个
     int solution = -1;
 
     for(i = 3; i < num_ctrlpts; i++) {
@@ -4314,7 +4902,6 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
                     intT.push_back(u[j]);
                 }
             }
-            ACIS_DELETE[] STD_CAST u;
         } else  // 转化为椭圆所在的平面与样条求交，然后判断点是否在椭圆上
         {
             double a0 = NAN, b0 = NAN, c0 = NAN, d0 = NAN;
@@ -4355,7 +4942,6 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
                     intT.push_back(u[j]);
                 }
             }
-            ACIS_DELETE[] STD_CAST u;
         }
     }
     /////////////////////////////////
@@ -4369,7 +4955,7 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
         tmpP = intPnts[i];
         param2 = intT[i];
         param1 = refine_param(ell.param(tmpP), tol);
-        end->next = ACIS_NEW curve_curve_int(nullptr, tmpP, param1, param2);
+        end->next = cci_new_inter(nullptr, tmpP, param1, param2);
         if(biparallel(bs3_curve_deriv(param2, bs3), ell.eval_direction(param1))) {
             end->next->low_rel = end->next->high_rel = curve_curve_rel::cur_cur_tangent;
         } else {
@@ -4384,7 +4970,7 @@ curve_curve_int* ellipse_bspline_int_implicitization(ellipse const& ell, bs3_cur
 
     // 销毁数据
     ACIS_DELETE ic;
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     ACIS_DELETE[] ctrlpts;
     ACIS_DELETE[] STD_CAST knots;
     ACIS_DELETE[] STD_CAST weights;
@@ -4635,6 +5221,207 @@ int NurbscToRBezier(bs3_curve nurbs, bs3_curve*& rbezier, double*& t) {
     return bez_num;
 }
 
+/**
+ * @brief 用开花(blossom)直接求出节点区间[knots[i], knots[i+1]]上Bezier曲线段的控制点，不要求两端为完全重节点
+ *        第k个控制点为开花值f(knots[i]^(p-k), knots[i+1]^k)，由de Boor递推在齐次坐标下计算
+ * @param p 次数
+ * @param comp 齐次坐标的四个分量，comp[c][j]为第j个控制点的分量
+ * @param knots 节点向量
+ * @param i 节点区间的下标，p <= i < num_knots-p-1
+ * @param out 输出的四个分量，out[c][k]为第k个Bezier控制点的分量
+ */
+static void NurbsBlossomSpan(int p, std::vector<double> const* comp, double const* knots, int i, double* const* out) {
+    double d[4][CCI_BEZIER_MAX_ORDER];
+    for(int k = 0; k <= p; ++k) {
+        for(int c = 0; c < 4; ++c) {
+            for(int j = 0; j <= p; ++j) {
+                d[c][j] = comp[c][i - p + j];
+            }
+        }
+        for(int r = 1; r <= p; ++r) {
+            double u = r <= p - k ? knots[i] : knots[i + 1];
+            for(int j = p; j >= r; --j) {
+                int idx = i - p + j;
+                double alpha = (u - knots[idx]) / (knots[idx + p + 1 - r] - knots[idx]);
+                for(int c = 0; c < 4; ++c) {
+                    d[c][j] = (1.0 - alpha) * d[c][j - 1] + alpha * d[c][j];
+                }
+            }
+        }
+        for(int c = 0; c < 4; ++c) {
+            out[c][k] = d[c][p];
+        }
+    }
+}
+
+/**
+ * @brief Boehm节点插入直接在控制点数组上将nurbs曲线分解为Bezier曲线段，不产生中间bs3_curve
+ *        闭曲线和周期曲线先在拷贝上打开；节点向量两端不是完全重节点时逐段用开花求控制点
+ * @return 分解成功返回true；曲线为空或控制点与节点个数不匹配时返回false
+ * @param nurbs 输入的nurbs曲线
+ * @param spans 输出的Bezier曲线段
+ */
+bool NurbscToBezierSpans(bs3_curve nurbs, NurbsBezierSpans& spans) {
+    spans.num_spans = 0;
+    if(!nurbs) {
+        return false;
+    }
+    bs3_curve opened = nullptr;
+    if(bs3_curve_closed(nurbs) || bs3_curve_periodic(nurbs)) {
+        opened = bs3_curve_copy(nurbs);
+        bs3_curve_set_open(opened);
+        nurbs = opened;
+    }
+    int p = bs3_curve_degree(nurbs);
+    int num_pts = 0, num_knots = 0, num_weights = 0;
+    SPAposition* ctrlpts = nullptr;
+    double* knots = nullptr;
+    double* weights = nullptr;
+    bs3_curve_control_points(nurbs, num_pts, ctrlpts, TRUE);
+    bs3_curve_knots(nurbs, num_knots, knots, TRUE);
+    if(bs3_curve_rational(nurbs)) {
+        bs3_curve_weights(nurbs, num_weights, weights, TRUE);
+    }
+
+    int m = num_knots - 1;  // 最后一个节点的下标
+    bool valid = p >= 1 && num_pts > p && num_knots == num_pts + p + 1 && (!weights || num_weights == num_pts);
+    bool clamped = valid;
+    for(int i = 1; clamped && i <= p; ++i) {  // 两端是否为p+1重节点
+        clamped = fabs(knots[i] - knots[0]) <= SPAresmch && fabs(knots[m - i] - knots[m]) <= SPAresmch;
+    }
+    if(!clamped && p >= CCI_BEZIER_MAX_ORDER) {
+        valid = false;
+    }
+    if(valid && !clamped) {
+        // 非夹持节点向量(周期曲线): 有效参数区间为[knots[p], knots[m-p]]，逐个非零长度的节点区间求Bezier控制点
+        int order = p + 1;
+        std::vector<double> comp[4];
+        for(int c = 0; c < 4; ++c) {
+            comp[c].resize(num_pts);
+        }
+        for(int j = 0; j < num_pts; ++j) {
+            double wt = weights ? weights[j] : 1.0;
+            comp[0][j] = wt * ctrlpts[j].x();
+            comp[1][j] = wt * ctrlpts[j].y();
+            comp[2][j] = wt * ctrlpts[j].z();
+            comp[3][j] = wt;
+        }
+        spans.degree = p;
+        spans.x.clear();
+        spans.y.clear();
+        spans.z.clear();
+        spans.w.clear();
+        spans.t.assign(1, knots[p]);
+        double out[4][CCI_BEZIER_MAX_ORDER];
+        double* out_ptrs[4] = {out[0], out[1], out[2], out[3]};
+        for(int i = p; i < m - p; ++i) {
+            if(knots[i + 1] - knots[i] <= SPAresmch) {
+                continue;
+            }
+            NurbsBlossomSpan(p, comp, knots, i, out_ptrs);
+            spans.x.insert(spans.x.end(), out[0], out[0] + order);
+            spans.y.insert(spans.y.end(), out[1], out[1] + order);
+            spans.z.insert(spans.z.end(), out[2], out[2] + order);
+            spans.w.insert(spans.w.end(), out[3], out[3] + order);
+            spans.t.push_back(knots[i + 1]);
+        }
+        spans.num_spans = static_cast<int>(spans.t.size()) - 1;
+    } else if(valid) {
+        // 见The NURBS Book算法A5.6，在齐次坐标下逐段插入节点至p重
+        int order = p + 1;
+        size_t size = (size_t)(num_pts - p) * order;
+        spans.degree = p;
+        spans.x.resize(size);
+        spans.y.resize(size);
+        spans.z.resize(size);
+        spans.w.resize(size);
+        spans.t.resize(num_pts - p + 1);
+        double* comp[4] = {spans.x.data(), spans.y.data(), spans.z.data(), spans.w.data()};
+        auto set_ctrlpt = [&](int dst, int src) {
+            double wt = weights ? weights[src] : 1.0;
+            comp[0][dst] = wt * ctrlpts[src].x();
+            comp[1][dst] = wt * ctrlpts[src].y();
+            comp[2][dst] = wt * ctrlpts[src].z();
+            comp[3][dst] = wt;
+        };
+        std::vector<double> alphas(p);
+        for(int i = 0; i < order; ++i) {
+            set_ctrlpt(i, i);
+        }
+        int a = p, b = p + 1, nb = 0;
+        spans.t[0] = knots[p];
+        while(b < m) {
+            int i = b;
+            while(b < m && fabs(knots[b + 1] - knots[b]) <= SPAresmch) {
+                ++b;
+            }
+            int mult = b - i + 1;
+            if(b < m && mult > p) {  // 内部节点重数超过次数，曲线不连续
+                valid = false;
+                break;
+            }
+            if(mult < p) {
+                double numer = knots[b] - knots[a];
+                for(int j = p; j > mult; --j) {
+                    alphas[j - mult - 1] = numer / (knots[a + j] - knots[a]);
+                }
+                int r = p - mult;  // 需要插入的次数
+                for(int j = 1; j <= r; ++j) {
+                    int save = r - j, s = mult + j;
+                    for(int k = p; k >= s; --k) {
+                        double alpha = alphas[k - s];
+                        for(int c = 0; c < 4; ++c) {
+                            comp[c][nb * order + k] = alpha * comp[c][nb * order + k] + (1.0 - alpha) * comp[c][nb * order + k - 1];
+                        }
+                    }
+                    if(b < m) {  // 下一段的控制点
+                        for(int c = 0; c < 4; ++c) {
+                            comp[c][(nb + 1) * order + save] = comp[c][nb * order + p];
+                        }
+                    }
+                }
+            }
+            spans.t[++nb] = knots[b];
+            if(b < m) {
+                for(int k = p - mult; k <= p; ++k) {
+                    set_ctrlpt(nb * order + k, b - p + k);
+                }
+                a = b;
+                ++b;
+            }
+        }
+        spans.num_spans = valid ? nb : 0;
+    }
+
+    ACIS_DELETE[] ctrlpts;
+    ACIS_DELETE[] STD_CAST knots;
+    ACIS_DELETE[] STD_CAST weights;
+    bs3_curve_delete(opened);
+    return valid && spans.num_spans > 0;
+}
+
+/**
+ * @brief de Casteljau算法在局部参数s处将齐次坐标交错存储(w*x, w*y, w*z, w)的Bezier曲线分为两段
+ * @param degree Bezier曲线的次数
+ * @param src 输入的控制点，长度为4*(degree+1)
+ * @param s 分割的局部参数
+ * @param left 输出[0, s]段的控制点
+ * @param right 输出[s, 1]段的控制点
+ */
+void NurbsBezierSplit(int degree, double const* src, double s, double* left, double* right) {
+    // right先作为工作数组，逐层求值后right[0..]为[s, 1]段的控制点
+    std::copy(src, src + 4 * (degree + 1), right);
+    std::copy(src, src + 4, left);
+    for(int r = 1; r <= degree; ++r) {
+        for(int i = 0; i <= degree - r; ++i) {
+            for(int c = 0; c < 4; ++c) {
+                right[4 * i + c] = (1.0 - s) * right[4 * i + c] + s * right[4 * (i + 1) + c];
+            }
+        }
+        std::copy(right, right + 4, left + 4 * r);
+    }
+}
+
 /**
  * @brief Nurbs曲线细分，转化为控制多边形点数组
  * @param curv 输入的Nurbs曲线
@@ -4643,60 +5430,53 @@ int NurbscToRBezier(bs3_curve nurbs, bs3_curve*& rbezier, double*& t) {
  * @param num_points 输出的控制多边形点数组的点的个数
  */
 void NurbsSubdivision(bs3_curve curv, SPAposition*& points, double*& splitpara, int& num_points) {
-    if(curv == nullptr) {
-        points = nullptr;
-        num_points = 0;
+    points = nullptr;
+    splitpara = nullptr;
+    num_points = 0;
+    NurbsBezierSpans spans;
+    if(!NurbscToBezierSpans(curv, spans)) {
         return;
     }
-    SPAinterval param_range = bs3_curve_range(curv);
-    int degree = bs3_curve_degree(curv);
-    int num_ctrlpts = bs3_curve_num_ctlpts(curv);
-    int max_segs = num_ctrlpts - degree + 1;
-    // 将nurbs曲线转化为多段Rbezier曲线
-    bs3_curve* rbeziers = nullptr;
-    double* split_paras = nullptr;
-    int num_rbeziers = NurbscToRBezier(curv, rbeziers, split_paras);
-
-    points = ACIS_NEW SPAposition[max_segs * 4 * (degree + 1)];
-    splitpara = ACIS_NEW double[max_segs * 4 * (degree + 1)];
-    num_points = 0;
-    for(int i = 0; i < num_rbeziers; ++i) {
-        bs3_curve sub_rbeziers[4];
-        double start = i ? split_paras[i - 1] : param_range.start_pt();
-        double end = i < num_rbeziers - 1 ? split_paras[i] : param_range.end_pt();
-        SubdRbezcToNCurve(rbeziers[i], sub_rbeziers);
+    int degree = spans.degree;
+    int order = degree + 1;
+    points = ACIS_NEW SPAposition[spans.num_spans * 4 * order];
+    splitpara = ACIS_NEW double[spans.num_spans * 4 * order];
+
+    // 工作数组: 一段Bezier曲线，二分后的两段，四分后的四段，均为齐次坐标交错存储
+    std::vector<double> work(7 * 4 * order);
+    double* span = work.data();
+    double* halves = span + 4 * order;
+    double* quarters = halves + 8 * order;
+    for(int i = 0; i < spans.num_spans; ++i) {
+        for(int k = 0; k < order; ++k) {
+            span[4 * k] = spans.x[i * order + k];
+            span[4 * k + 1] = spans.y[i * order + k];
+            span[4 * k + 2] = spans.z[i * order + k];
+            span[4 * k + 3] = spans.w[i * order + k];
+        }
+        // 将每段Bezier曲线四等分
+        NurbsBezierSplit(degree, span, 0.5, halves, halves + 4 * order);
+        NurbsBezierSplit(degree, halves, 0.5, quarters, quarters + 4 * order);
+        NurbsBezierSplit(degree, halves + 4 * order, 0.5, quarters + 8 * order, quarters + 12 * order);
+
+        double start = spans.t[i];
+        double end = spans.t[i + 1];
         for(int j = 0; j < 4; ++j) {
             double sub_start = start + (end - start) * j / 4;
             double sub_end = sub_start + (end - start) / 4;
-            SPAposition* control_points = nullptr;
-            int num_pts = 0;
-            bs3_curve_control_points(sub_rbeziers[j], num_pts, control_points);
-            for(int k = 0; k < num_pts - 1; ++k) {
-                splitpara[num_points] = sub_start + (sub_end - sub_start) * k / (num_pts - 1);
-                points[num_points++] = control_points[k];
-            }
-            if(i == num_rbeziers - 1 && j == 3) {
-                splitpara[num_points] = sub_end;
-                points[num_points++] = control_points[num_pts - 1];
+            double const* ctrl = quarters + 4 * order * j;
+            int num_pts = (i == spans.num_spans - 1 && j == 3) ? order : degree;  // 最后一段保留终点
+            for(int k = 0; k < num_pts; ++k) {
+                splitpara[num_points] = sub_start + (sub_end - sub_start) * k / degree;
+                points[num_points++] = SPAposition(ctrl[4 * k] / ctrl[4 * k + 3], ctrl[4 * k + 1] / ctrl[4 * k + 3], ctrl[4 * k + 2] / ctrl[4 * k + 3]);
             }
-            ACIS_DELETE[] control_points;
-            control_points = nullptr;
-            bs3_curve_delete(sub_rbeziers[j]);  // 待解耦，存在问题 @todo: bs3_curve相关问题
-            sub_rbeziers[j] = nullptr;
         }
-        bs3_curve_delete(rbeziers[i]);
-        rbeziers[i] = nullptr;
     }
-    ACIS_DELETE[] STD_CAST split_paras;
-    ACIS_DELETE[] rbeziers;
-    split_paras = nullptr;
-    rbeziers = nullptr;
 }
 
 /** 使用最优化方法求cur1和cur2的最近点对  */
 double MinDistancePointPair_Impl(curve const& cur1, curve const& cur2, Vector<2> const& vec0, SPAposition& pt1, SPAposition& pt2, int maxiter) {
-    std::vector<void const*> params = {&cur1, &cur2};
-    Vector<2> output = minimize(distanceF, vec0, params, 1e-12, maxiter);
+    Vector<2> output = nelder_mead_minimize<2>(CurveDistanceObjective{cur1, cur2}, vec0, 1e-12, maxiter);
 
     pt1 = cur1.eval_position(output(0, 0));
     pt2 = cur2.eval_position(output(1, 0));
@@ -4705,37 +5485,10 @@ double MinDistancePointPair_Impl(curve const& cur1, curve const& cur2, Vector<2>
 
 /** 使用最优化方法求cur1和cur2的最近点对  */
 double cur1_cur2_MinDistancePointPair_Impl(curve const& cur1, curve const& cur2, Vector<2> const& vec0, SPAposition& pt1, SPAposition& pt2, int maxiter) {
-    maxiter = 100;
-    Vector<2> output = vec0;
-    double dis, dis_to_cur1, dis_to_cur2;
-    while(maxiter--) {
-        SPAposition p1, p2;
-        SPAvector u1, v1, u2, v2;
-        cur1.eval(output(0, 0), p1, u1, u2);
-        cur2.eval(output(1, 0), p2, v1, v2);
-        double Hessian[2][2], grad[2], inverse_Hessian[2][2], delta;
-        Hessian[0][0] = 2 * u1 % u1 + 2 * (p1 - p2) % u2;
-        Hessian[0][1] = -2 * u1 % v1;
-        Hessian[1][0] = -2 * u1 % v1;
-        Hessian[1][1] = 2 * v1 % v1 + 2 * (p1 - p2) % v2;
-        grad[0] = 2 * (p1 - p2) % u1;
-        grad[1] = -2 * (p1 - p2) % v1;
-        delta = Hessian[0][0] * Hessian[1][1] - Hessian[0][1] * Hessian[1][0];
-        if(fabs(delta) == 0) break;
-        inverse_Hessian[0][0] = Hessian[1][1] / delta;
-        inverse_Hessian[0][1] = -Hessian[0][1] / delta;
-        inverse_Hessian[1][0] = -Hessian[1][0] / delta;
-        inverse_Hessian[1][1] = Hessian[0][0] / delta;
-        output(0, 0) = output(0, 0) - (inverse_Hessian[0][0] * grad[0] + inverse_Hessian[0][1] * grad[1]);
-        output(1, 0) = output(1, 0) - (inverse_Hessian[1][0] * grad[0] + inverse_Hessian[1][1] * grad[1]);
-        if(fabs((inverse_Hessian[0][0] * grad[0] + inverse_Hessian[0][1] * grad[1])) < 1e-7 && fabs(inverse_Hessian[1][0] * grad[0] + inverse_Hessian[1][1] * grad[1]) < 1e-7) {
-            break;
-        }
-    }
+    Vector<2> output = damped_newton_minimize<2>(CurveDistanceObjective{cur1, cur2}, vec0, 1e-7, 100);
     pt1 = cur1.eval_position(output(0, 0));
     pt2 = cur2.eval_position(output(1, 0));
-    dis = distance_to_point(pt1, pt2);
-    return dis;
+    return distance_to_point(pt1, pt2);
 }
 
 // 定义二元目标函数
@@ -4750,10 +5503,7 @@ Vector<2> objF(Vector<2> const& input, std::vector<void const*> const& params) {
 
 // 定义二元距离函数
 double distanceF(Vector<2> const& input, std::vector<void const*> const& params) {
-    curve const* cur1 = static_cast<curve const*>(params[0]);
-    curve const* cur2 = static_cast<curve const*>(params[1]);
-    SPAvector distance_vec = cur1->eval_position(input(0, 0)) - cur2->eval_position(input(1, 0));
-    return 0.5 * distance_vec.len_sq();
+    return CurveDistanceObjective{*static_cast<curve const*>(params[0]), *static_cast<curve const*>(params[1])}(input);
 }
 
 // 直线椭圆求交牛顿迭代求精接口
@@ -4949,11 +5699,11 @@ curve_curve_int* ellipse_ellipse_coin(ellipse const& cci_ellipse1, ellipse const
                     pa2_ed -= 2 * M_PI;
                 }
             }
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point_st, pa1_st, pa2_st);
+            coin_end->next = cci_new_inter(nullptr, int_point_st, pa1_st, pa2_st);
             coin_end->next->low_rel = curve_curve_rel::cur_cur_unknown;
             coin_end->next->high_rel = curve_curve_rel::cur_cur_coin;
             coin_end = coin_end->next;
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point_ed, pa1_ed, pa2_ed);
+            coin_end->next = cci_new_inter(nullptr, int_point_ed, pa1_ed, pa2_ed);
             coin_end->next->low_rel = curve_curve_rel::cur_cur_coin;
             coin_end->next->high_rel = curve_curve_rel::cur_cur_unknown;
             coin_end = coin_end->next;
@@ -4961,7 +5711,7 @@ curve_curve_int* ellipse_ellipse_coin(ellipse const& cci_ellipse1, ellipse const
             pa1 = overlap.mid_pt();
             int_point = cci_ellipse1.eval_position(pa1);
             pa2 = cci_ellipse2.param(int_point);
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point, pa1, pa2);
+            coin_end->next = cci_new_inter(nullptr, int_point, pa1, pa2);
             if(biparallel(cci_ellipse1.point_direction(int_point), cci_ellipse2.point_direction(int_point))) {
                 coin_end->next->low_rel = coin_end->next->high_rel = curve_curve_rel::cur_cur_tangent;
             } else {
@@ -4971,10 +5721,117 @@ curve_curve_int* ellipse_ellipse_coin(ellipse const& cci_ellipse1, ellipse const
         }
     }
     curve_curve_int* coin_inters = coin_head->next;
-    ACIS_DELETE coin_head;
+    cci_delete_inter(coin_head);
     return coin_inters;
 }
 
+/**
+ * @brief 共面椭圆求交(结式法): 椭圆1以半角正切代换有理参数化后代入椭圆2的隐式方程得到四次方程，根用一步牛顿迭代精化
+ * 四次方程的根只覆盖|t| <= pi/2，另以t = pi + theta代换求其余的根；四次方程导数的根在容差内位于椭圆2上时作为切点
+ * @return 线线求交结果
+ * @param ell1 输入椭圆1
+ * @param ell2 输入椭圆2，与ell1共面且不重合
+ * @param tol 容差
+ */
+curve_curve_int* coplanar_ellipse_ellipse_int(ellipse const& ell1, ellipse const& ell2, double tol) {
+    // 椭圆1上的点在椭圆2局部坐标系下(以半轴长为单位)的坐标 X = x0 + xc * cos(t) + xs * sin(t)，Y同理
+    // t从长轴端点起算，对应椭圆1的参数t + param_off，与cci_clip_ellipse_to_box一致
+    SPAvector minor1 = (ell1.normal * ell1.major_axis) * ell1.radius_ratio;
+    double a2 = ell2.major_axis.len(), b2 = a2 * ell2.radius_ratio;
+    SPAunit_vector u2 = normalise(ell2.major_axis);
+    SPAunit_vector v2 = normalise(ell2.normal * u2);
+    SPAvector d = ell1.centre - ell2.centre;
+    double x0 = (d % u2) / a2, xc = (ell1.major_axis % u2) / a2, xs = (minor1 % u2) / a2;
+    double y0 = (d % v2) / b2, yc = (ell1.major_axis % v2) / b2, ys = (minor1 % v2) / b2;
+    // F(t) = X^2 + Y^2 - 1 = A + B * cos(t) + C * sin(t) + D * cos(t)^2 + E * sin(t)^2 + G * cos(t) * sin(t)
+    double A = x0 * x0 + y0 * y0 - 1, B = 2 * (x0 * xc + y0 * yc), C = 2 * (x0 * xs + y0 * ys);
+    double D = xc * xc + yc * yc, E = xs * xs + ys * ys, G = 2 * (xc * xs + yc * ys);
+    auto newton_step = [&](double t) {
+        double c = cos(t), s = sin(t);
+        double f = A + B * c + C * s + D * c * c + E * s * s + G * c * s;
+        double df = -B * s + C * c + 2 * (E - D) * c * s + G * (c * c - s * s);
+        return fabs(df) > SPAresmch ? t - f / df : t;
+    };
+
+    std::vector<double> params;
+    for(int half = 0; half < 2; ++half) {
+        // 第二次以t = pi + theta代换，cos(t)、sin(t)变号，二次项不变
+        double sgn = half ? -1.0 : 1.0;
+        double b = sgn * B, c = sgn * C;
+        // 以u = tan(theta / 2)代换并乘以(1 + u^2)^2
+        double coef[5] = {A - b + D, 2 * (c - G), 2 * (A - D) + 4 * E, 2 * (c + G), A + b + D};
+        double dcoef[4] = {4 * coef[0], 3 * coef[1], 2 * coef[2], coef[3]};
+        double roots[4];
+        int num = solve_poly_roots(4, coef, -1.0, 1.0, roots);
+        for(int i = 0; i < num; ++i) {
+            params.push_back(newton_step(half * M_PI + 2 * atan(roots[i])));
+        }
+        num = solve_poly_roots(3, dcoef, -1.0, 1.0, roots);
+        for(int i = 0; i < num; ++i) {
+            params.push_back(half * M_PI + 2 * atan(roots[i]));
+        }
+    }
+
+    curve_curve_int *head, *end;
+    head = end = ZeroInter;
+    std::vector<SPAposition> found;
+    double param_off = ell1.param_off;
+    for(double t: params) {
+        SPAposition int_point = ell1.eval_position(t + param_off);
+        if(!ell2.test_point_tol(int_point, tol)) {
+            continue;
+        }
+        // 重根与导数的根给出同一个切点，只保留一个
+        if(std::any_of(found.begin(), found.end(), [&int_point, tol](SPAposition const& pos) { return distance_to_point(pos, int_point) <= tol; })) {
+            continue;
+        }
+        found.push_back(int_point);
+        end->next = cci_new_inter(nullptr, int_point, refine_param(ell1.param(int_point), SPAresabs), refine_param(ell2.param(int_point), SPAresabs));
+        end = end->next;
+    }
+    end->next = nullptr;
+    curve_curve_int* inters = head->next;
+    cci_delete_inter(head);
+    return inters;
+}
+
+/**
+ * @brief 不共面椭圆求交: 两椭圆的交点必在两个平面的交线上，转化为交线分别与两个椭圆求交，取两组交点中重合的点
+ * @return 线线求交结果
+ * @param ell1 输入椭圆1
+ * @param ell2 输入椭圆2，所在平面与ell1所在平面不平行
+ * @param box 包围盒
+ * @param tol 容差
+ */
+curve_curve_int* noncoplanar_ellipse_ellipse_int(ellipse const& ell1, ellipse const& ell2, SPAbox const& box, double tol) {
+    // 交线过点ell1.centre + alpha * n1 + beta * n2，由该点分别在两个平面上解出alpha、beta
+    double n12 = ell1.normal % ell2.normal;
+    double h = ell2.normal % (ell2.centre - ell1.centre);
+    double beta = h / (1 - n12 * n12), alpha = -n12 * beta;
+    straight line(ell1.centre + alpha * ell1.normal + beta * ell2.normal, normalise(ell1.normal * ell2.normal));
+
+    curve_curve_int* inters1 = straight_ellipse_int(line, ell1, box, tol);
+    curve_curve_int* inters2 = inters1 ? straight_ellipse_int(line, ell2, box, tol) : nullptr;
+    curve_curve_int *head, *end;
+    head = end = ZeroInter;
+    for(curve_curve_int* inter1 = inters1; inter1; inter1 = inter1->next) {
+        for(curve_curve_int* inter2 = inters2; inter2; inter2 = inter2->next) {
+            if(distance_to_point(inter1->int_point, inter2->int_point) <= tol) {
+                SPAposition int_point = mid_point(inter1->int_point, inter2->int_point);
+                end->next = cci_new_inter(nullptr, int_point, refine_param(ell1.param(int_point), SPAresabs), refine_param(ell2.param(int_point), SPAresabs));
+                end = end->next;
+                break;
+            }
+        }
+    }
+    end->next = nullptr;
+    cci_delete_inters(inters1);
+    cci_delete_inters(inters2);
+    curve_curve_int* inters = head->next;
+    cci_delete_inter(head);
+    return inters;
+}
+
 /**
  * @brief 根据重合的参数区间(cur1上的参数区间)构造线线求交结果类
  * @return 线线求交结果类
@@ -5004,7 +5861,7 @@ curve_curve_int* construct_coin_inters(curve const& cur1, curve const& cur2, std
             param1 = coin_int1_array[i].start_pt();
             int_point = cur1.eval_position(param1);
             param2 = param2_st;  // 待解耦，存在问题 @todo: intcurve相关问题
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point, param1, param2);
+            coin_end->next = cci_new_inter(nullptr, int_point, param1, param2);
             coin_end->next->low_rel = curve_curve_rel::cur_cur_unknown;
             coin_end->next->high_rel = curve_curve_rel::cur_cur_coin;
             coin_end = coin_end->next;
@@ -5012,7 +5869,7 @@ curve_curve_int* construct_coin_inters(curve const& cur1, curve const& cur2, std
             param1 = coin_int1_array[i].end_pt();
             int_point = cur1.eval_position(param1);
             param2 = param2_ed;  // 待解耦，存在问题 @todo: intcurve相关问题 NurbsNurbsIntrTest.TestBug30
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point, param1, param2);
+            coin_end->next = cci_new_inter(nullptr, int_point, param1, param2);
             coin_end->next->low_rel = curve_curve_rel::cur_cur_coin;
             coin_end->next->high_rel = curve_curve_rel::cur_cur_unknown;
             coin_end = coin_end->next;
@@ -5025,7 +5882,7 @@ curve_curve_int* construct_coin_inters(curve const& cur1, curve const& cur2, std
             } else {
                 param2 = cur2.param(int_point);
             }
-            coin_end->next = ACIS_NEW curve_curve_int(nullptr, int_point, param1, param2);
+            coin_end->next = cci_new_inter(nullptr, int_point, param1, param2);
             if(biparallel(cur1.point_direction(int_point), cur2.point_direction(int_point))) {
                 coin_end->next->low_rel = coin_end->next->high_rel = curve_curve_rel::cur_cur_tangent;
             } else {
@@ -5035,7 +5892,7 @@ curve_curve_int* construct_coin_inters(curve const& cur1, curve const& cur2, std
         }
     }
     curve_curve_int* coin_inters = coin_head->next;
-    ACIS_DELETE coin_head;
+    cci_delete_inter(coin_head);
     return coin_inters;
 }
 
@@ -5087,12 +5944,12 @@ curve_curve_int* judge_curve_ends(curve const& cur1, curve const& cur2) {
         param_range1 = cur1.param_range();  // 待解偶，存在问题
         point = cur1.eval_position(param_range1.start_pt());
         if(cur2.test_point_tol(point)) {
-            ret = ACIS_NEW curve_curve_int(pre, point, param_range1.start_pt(), cur2.param(point));
+            ret = cci_new_inter(pre, point, param_range1.start_pt(), cur2.param(point));
             pre = ret;
         }
         point = cur1.eval_position(param_range1.end_pt());
         if(cur2.test_point_tol(point)) {
-            ret = ACIS_NEW curve_curve_int(pre, point, param_range1.end_pt(), cur2.param(point));
+            ret = cci_new_inter(pre, point, param_range1.end_pt(), cur2.param(point));
             pre = ret;
         }
     }
@@ -5101,12 +5958,12 @@ curve_curve_int* judge_curve_ends(curve const& cur1, curve const& cur2) {
         param_range2 = cur2.param_range();  // 待解偶，存在问题
         point = cur2.eval_position(param_range2.start_pt());
         if(cur1.test_point_tol(point)) {  // @todo: 存在内存泄漏问题
-            ret = ACIS_NEW curve_curve_int(pre, point, cur1.param(point), param_range2.start_pt());
+            ret = cci_new_inter(pre, point, cur1.param(point), param_range2.start_pt());
             pre = ret;
         }
         point = cur2.eval_position(param_range2.end_pt());
         if(cur1.test_point_tol(point)) {  // @todo: 存在内存泄漏问题
-            ret = ACIS_NEW curve_curve_int(pre, point, cur1.param(point), param_range2.end_pt());
+            ret = cci_new_inter(pre, point, cur1.param(point), param_range2.end_pt());
             pre = ret;
         }
     }
@@ -5214,9 +6071,9 @@ curve_curve_int* maf_coplnar_helix_bs3_int(helix const& hel, intcurve const& ic,
     }
 #endif
 
-    delete_curve_curve_ints(interp);
+    cci_delete_inters(interp);
     bs3_curve_delete(bs3);
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     ACIS_DELETE[] points;
     ACIS_DELETE[] STD_CAST splitpara;
 
@@ -5288,7 +6145,7 @@ void line_nurbs_iterate(straight const& st, bs3_curve nurbs, curve_curve_int* ne
             // @todo:test_point_tol函数未解耦：耗时过长暂不解耦
             if(bs3_curve_testpt(cp1, SPAresabs, nurbs) && st.test_point_tol(cp2)) {
                 ++inters_num;
-                end->next = ACIS_NEW curve_curve_int(nullptr, mid_point(cp1, cp2), near_result->param1, near_result->param2);
+                end->next = cci_new_inter(nullptr, mid_point(cp1, cp2), near_result->param1, near_result->param2);
                 double angle = VEC_acute_angle(deriv, dir);
                 // 部分用例 biparallel通不过，通过计算夹角判断相切
                 if(fabs(angle) <= 1e-7) {
@@ -5303,7 +6160,7 @@ void line_nurbs_iterate(straight const& st, bs3_curve nurbs, curve_curve_int* ne
     }
     ret = head->next;
     inters_num = CurvCurvIntPointReduce(ret);
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     refine_result = ret;
 }
 
@@ -5396,7 +6253,7 @@ void curve_nurbs_iterate(curve const& curv, bs3_curve nurbs, curve_curve_int* ne
                 // @todo:test_point_tol函数未解耦:test_point_tol耗时过长暂不解耦
                 if(bs3_curve_testpt(cp1, SPAresabs, nurbs) && curv.test_point_tol(cp2)) {
                     ++inters_num;
-                    end->next = ACIS_NEW curve_curve_int(nullptr, mid_point(cp1, cp2), near_result->param1, near_result->param2);
+                    end->next = cci_new_inter(nullptr, mid_point(cp1, cp2), near_result->param1, near_result->param2);
                     double angle = VEC_acute_angle(deriv1, deriv2);
                     // 部分用例 biparallel通不过，通过计算夹角判断相切
                     if(fabs(angle) <= 1e-7) {
@@ -5412,25 +6269,18 @@ void curve_nurbs_iterate(curve const& curv, bs3_curve nurbs, curve_curve_int* ne
         end->next = nullptr;
         ret = head->next;
         inters_num = CurvCurvIntPointReduce(ret);
-        ACIS_DELETE head;
+        cci_delete_inter(head);
         refine_result = ret;
     }
 }
 
 double intersectF(Vector<2> const& vec0, std::vector<void const*> const& params) {
-    curve const* cur1 = static_cast<curve const*>(params[0]);
-    curve const* cur2 = static_cast<curve const*>(params[1]);
-
-    double u = vec0(0, 0), v = vec0(1, 0);
-    SPAvector ndistance_vec = normalise(cur1->eval_position(u) - cur2->eval_position(v));
-    double f1 = ndistance_vec % normalise(cur1->eval_deriv(u));
-    double f2 = ndistance_vec % normalise(cur2->eval_deriv(v));
-    return 0.5 * (f1 * f1 + f2 * f2);
+    return CurveIntersectObjective{*static_cast<curve const*>(params[0]), *static_cast<curve const*>(params[1])}(vec0);
 }
 
 // curve-curve 迭代求交
 void curve_curve_iterate_minimize(curve const& curv, curve const& curve2, curve_curve_int* near_result, curve_curve_int*& refine_result) {
-    std::vector<void const*> params = {&curv, &curve2};
+    CurveIntersectObjective const objective{curv, curve2};
     refine_result = nullptr;
     curve_curve_int* pre = nullptr;
     while(near_result) {
@@ -5439,7 +6289,7 @@ void curve_curve_iterate_minimize(curve const& curv, curve const& curve2, curve_
         // double param1 = curv.param_range().infinite() ? 0.0 : curv.param_range().mid_pt();
         // double param2 = curve2.param_range().infinite() ? 0.0 : curve2.param_range().mid_pt();
         Vector<2> v0({param1, param2});
-        Vector<2> output = minimize(intersectF, v0, params, 1e-12);
+        Vector<2> output = nelder_mead_minimize<2>(objective, v0, 1e-12);
         param1 = output(0, 0);
         param2 = output(1, 0);
 
@@ -5453,7 +6303,7 @@ void curve_curve_iterate_minimize(curve const& curv, curve const& curve2, curve_
         if(curv.test_point_tol(int_point) && curve2.test_point_tol(int_point)) {
             param1 = curv.param(int_point);
             param2 = curve2.param(int_point);
-            refine_result = ACIS_NEW curve_curve_int(pre, int_point, param1, param2);
+            refine_result = cci_new_inter(pre, int_point, param1, param2);
             if(biparallel(curv.point_direction(int_point), curve2.point_direction(int_point))) {
                 refine_result->low_rel = refine_result->high_rel = curve_curve_rel::cur_cur_tangent;
             } else {
@@ -5507,7 +6357,7 @@ curve_curve_int* tolerance_int_cur_cur(curve const& cur1, curve const& cur2, std
         double dis_to_cur1 = distance_to_curve(int_point, cur1);
         double dis_to_cur2 = distance_to_curve(int_point, cur2);
         if(dis_to_cur1 <= tol && dis_to_cur2 <= tol && dis <= tol) {  // ACIS test_point_tol设置容差不起作用 IntersectorStraightStraight.TestBug18
-            inters = ACIS_NEW curve_curve_int(nullptr, int_point, cur1.param(int_point), cur2.param(int_point));
+            inters = cci_new_inter(nullptr, int_point, cur1.param(int_point), cur2.param(int_point));
             inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_normal;  // 容差内的交点关系可能为tangent
             SPAvector dir1 = cur1.point_direction(int_point);
             SPAvector dir2 = cur2.point_direction(int_point);
@@ -5540,7 +6390,7 @@ curve_curve_int* cur1_cur2_tolerance_newton(curve const& cur1, curve const& cur2
         double dis_to_cur1 = distance_to_curve(int_point, cur1);
         double dis_to_cur2 = distance_to_curve(int_point, cur2);
         if(dis_to_cur1 <= tol && dis_to_cur2 <= tol && dis <= tol) {  // ACIS test_point_tol设置容差不起作用 IntersectorStraightStraight.TestBug18
-            inters = ACIS_NEW curve_curve_int(nullptr, int_point, cur1.param(int_point), cur2.param(int_point));
+            inters = cci_new_inter(nullptr, int_point, cur1.param(int_point), cur2.param(int_point));
             inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_normal;  // 容差内的交点关系可能为tangent
             SPAvector dir1 = cur1.point_direction(int_point);
             SPAvector dir2 = cur2.point_direction(int_point);
@@ -5559,6 +6409,7 @@ curve_curve_int* cur1_cur2_tolerance_newton(curve const& cur1, curve const& cur2
  * @brief 获得曲线的包围盒
  */
 SPAbox bound_of_curve(curve const& curv) {
+    CCI_STAT_INC(bound_calls);
     SPAinterval inf_interval(interval_infinite, 0.0, 0.0);
     SPAbox box(inf_interval, inf_interval, inf_interval);  // infinite box
     if(curv.type() == straight_type) {
@@ -5591,158 +6442,8 @@ SPAbox bound_of_curve(curve const& curv) {
  * @brief 给定初始值_x0, 求func的最小值
  */
 Vector<2> minimize(ScalarFunc2dType const& func, Vector<2> const& _x0, std::vector<void const*> const& params, double tol, int maxiter, bool adaptive) {
-    const int N = 2;
-    Vector<N> x0 = _x0;
-    double rho, chi, psi, sigma;
-    if(adaptive) {
-        double dim = static_cast<float>(N);
-        rho = 1;
-        chi = 1 + 2 / dim;
-        psi = 0.75 - 1 / (2 * dim);
-        sigma = 1 - 1 / dim;
-    } else {
-        rho = 1;
-        chi = 2;
-        psi = 0.5;
-        sigma = 0.5;
-    }
-    //
-    double nonzdelt = 0.05;
-    double zdelt = 0.00025;
-    int ncalls = 0;
-    Matrix<N + 1, N> sim;
-
-    sim.set_row(0, x0);
-    for(int k = 0; k < N; ++k) {
-        Vector<2> y = x0;
-        if(fabs(y(k, 0)) > 2.22e-16) {  // toler
-            y(k, 0) = (1 + nonzdelt) * y(k, 0);
-        } else {
-            y(k, 0) = zdelt;
-        }
-        sim.set_row(k + 1, y);
-    }
-
-    double xatol, fatol;
-    xatol = fatol = tol;
-    if(maxiter == -1) {  // 默认最大迭代次数
-        maxiter = N * 300;
-    }
-    int maxfun = N * 300;  // 手动设置上界，防止无限循环
-
-    std::vector<int> one2np1(N);  //= list(range(1, N + 1))
-    for(int i = 0; i < N; ++i) {
-        one2np1[i] = i + 1;
-    }
-    Vector<N + 1> fsim(std::vector<double>(N + 1, DBL_MAX));
-    for(int k = 0; k < N + 1; ++k) {
-        fsim(k, 0) = func(sim.get_row(k), params);  // Minimal Question
-        ncalls++;
-    }
-    std::vector<int> ind = argsort(fsim);
-    Vector<N + 1> copy_fsim = fsim;
-    Matrix<N + 1, N> copy_sim = sim;
-    for(int i = 0; i < N + 1; ++i) {
-        fsim(i, 0) = copy_fsim(ind[i], 0);
-        sim.set_row(i, copy_sim.get_row(ind[i]));  // sort so sim[0,:] has the lowest function value
-    }
-
-    int iterations = 1;
-    auto abs = [](double a) { return fabs(a); };
-    while(ncalls < maxfun && iterations < maxiter) {
-        Vector<N> fsim_except0;
-        for(int i = 0; i < N; ++i) {
-            fsim_except0(i, 0) = fsim(i + 1, 0);
-        }
-        double maxval = -DBL_MAX;
-        for(int i = 0; i < N; ++i) {
-            maxval = D3_max(maxval, max(apply(abs, sim.get_row(i + 1) - sim.get_row(0))));
-        }
-        double maxfval = max(apply(abs, fsim_except0 - fsim(0, 0)));
-        if(maxval <= xatol && maxfval <= fatol) {
-            break;
-        }
-        Vector<N> xbar;
-        for(int i = 0; i < N; ++i) {
-            for(int j = 0; j < N; ++j) {
-                xbar(i, 0) += sim(j, i) / N;
-            }
-        }
-        Vector<N> xr = (1 + rho) * xbar - rho * sim.get_row(N);
-        double fxr = func(xr, params);
-        ncalls++;
-        int doshrink = 0;
-
-        if(fxr < fsim(0, 0)) {
-            Vector<N> xe = (1 + rho * chi) * xbar - rho * chi * sim.get_row(N);
-            double fxe = func(xe, params);
-            ncalls++;
-
-            if(fxe < fxr) {
-                sim.set_row(N, xe);
-                fsim(N, 0) = fxe;
-            } else {
-                sim.set_row(N, xr);
-                fsim(N, 0) = fxr;
-            }
-        } else {  // fsim[0] <= fxr
-            if(fxr < fsim(N - 1, 0)) {
-                sim.set_row(N, xr);
-                fsim(N, 0) = fxr;
-            } else {  // fxr >= fsim[-2]
-                // Perform contraction
-                if(fxr < fsim(N, 0)) {
-                    Vector<N> xc = (1 + psi * rho) * xbar - psi * rho * sim.get_row(N);
-                    double fxc = func(xc, params);
-                    ncalls++;
-
-                    if(fxc <= fxr) {
-                        sim.set_row(N, xc);
-                        fsim(N, 0) = fxc;
-                    } else {
-                        doshrink = 1;
-                    }
-                } else {
-                    // Perform an inside contraction
-                    Vector<N> xcc = (1 - psi) * xbar + psi * sim.get_row(N);
-                    double fxcc = func(xcc, params);
-                    ncalls++;
-
-                    if(fxcc < fsim(N, 0)) {
-                        sim.set_row(N, xcc);
-                        fsim(N, 0) = fxcc;
-                    } else {
-                        doshrink = 1;
-                    }
-                }
-
-                if(doshrink) {
-                    for(int j: one2np1) {
-                        sim.set_row(j, sim.get_row(0) + sigma * (sim.get_row(j) - sim.get_row(0)));
-                        fsim(j, 0) = func(sim.get_row(j), params);
-                        ncalls++;
-                    }
-                }
-            }
-        }
-        std::vector<int> ind = argsort(fsim);
-        Vector<N + 1> copy_fsim = fsim;
-        Matrix<N + 1, N> copy_sim = sim;
-        for(int i = 0; i < N + 1; ++i) {
-            fsim(i, 0) = copy_fsim(ind[i], 0);
-            sim.set_row(i, copy_sim.get_row(ind[i]));
-        }
-        iterations += 1;
-    }
-
-    Vector<N> x = sim.get_row(0);
-    double fval = min(fsim);
-    // if(iterations >= maxiter) {
-    //     std::cout << "error" << std::endl;
-    // } else {
-    //     std::cout << "success" << std::endl;
-    // }
-    return x;
+    auto objective = [&func, &params](Vector<2> const& x) { return func(x, params); };
+    return nelder_mead_minimize<2>(objective, _x0, tol, maxiter, adaptive);
 }
 
 /**
@@ -5766,6 +6467,7 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
     if(!nurbs1 || !nurbs2) {
         return nullptr;
     }
+    CCI_STAT_TIMER(near_inters);
 
     // SPAinterval range1 = bs3_curve_range(nurbs1);
     // SPAinterval range2 = bs3_curve_range(nurbs2);
@@ -5784,6 +6486,19 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
     std::unordered_map<double, SPAbox> box_map1;
     std::unordered_map<double, SPAbox> box_map2;
     std::unordered_map<double, SPAbox>::iterator iter;
+    // 包围盒重合时，再以子曲线控制多边形凸包的分离轴测试排除无交的单元
+    std::vector<CciBezier> beziers1, beziers2;
+    bool use_hulls = cci_nurbs_to_beziers(nurbs1, beziers1) && cci_nurbs_to_beziers(nurbs2, beziers2);
+    std::unordered_map<double, std::vector<SPAposition>> hull_map1;
+    std::unordered_map<double, std::vector<SPAposition>> hull_map2;
+    auto hull_of = [](std::unordered_map<double, std::vector<SPAposition>>& hull_map, std::vector<CciBezier> const& beziers, SPAinterval const& range) -> std::vector<SPAposition> const& {
+        auto found = hull_map.find(range.mid_pt());
+        if(found == hull_map.end()) {
+            found = hull_map.emplace(range.mid_pt(), std::vector<SPAposition>()).first;
+            cci_bezier_hull(beziers, range, found->second);
+        }
+        return found->second;
+    };
 
     while(!q->empty()) {
         ++level;
@@ -5813,6 +6528,7 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
                     } else {
                         // @todo: bound耗时较长暂不解耦
                         box1 = enlarge_box(std::move(ic1->bound(subs1[i])), margin1);
+                        CCI_STAT_INC(bound_calls);
                         box_map1.insert(std::make_pair(subs1[i].mid_pt(), box1));
                         ++num_calls;
                     }
@@ -5821,10 +6537,14 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
                     } else {
                         // @todo: bound耗时较长暂不解耦
                         box2 = enlarge_box(std::move(ic2->bound(subs2[j])), margin2);
+                        CCI_STAT_INC(bound_calls);
                         box_map2.insert(std::make_pair(subs2[j].mid_pt(), box2));
                         ++num_calls;
                     }
                     if(box1 && box2) {
+                        if(use_hulls && cci_hulls_separated(hull_of(hull_map1, beziers1, subs1[i]), hull_of(hull_map2, beziers2, subs2[j]), margin1 + margin2)) {
+                            continue;
+                        }
                         new_q->push(std::make_pair(subs1[i], subs2[j]));
                     }
                 }
@@ -5836,13 +6556,28 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
         q = tmp;
     }
 
-    curve_curve_int *pre = nullptr, *ret = nullptr;
     // std::cout << "final queue\n";
+    std::vector<double> seed_params1, seed_params2;
     while(!q->empty()) {
         const auto& front = q->front();
-        q->pop();
         // printf("{%lf, %lf}, {%lf, %lf}\n", front.first.start_pt(), front.first.end_pt(), front.second.start_pt(), front.second.end_pt());
-        ret = ACIS_NEW curve_curve_int(pre, {0, 0, 0}, front.first.mid_pt(), front.second.mid_pt());
+        seed_params1.push_back(front.first.mid_pt());
+        seed_params2.push_back(front.second.mid_pt());
+        q->pop();
+    }
+    // 近似交点取两条曲线在单元中点处的位置的中点，批量求值
+    std::vector<SPAposition> seed_pos1(seed_params1.size()), seed_pos2(seed_params2.size());
+    if(use_hulls && !seed_params1.empty()) {
+        CciBs3Evaluator evaluator1, evaluator2;
+        evaluator1.init(beziers1);
+        evaluator2.init(beziers2);
+        seed_pos1 = evaluator1.positions(seed_params1);
+        seed_pos2 = evaluator2.positions(seed_params2);
+    }
+    curve_curve_int *pre = nullptr, *ret = nullptr;
+    for(size_t i = 0; i < seed_params1.size(); ++i) {
+        ret = cci_new_inter(pre, mid_point(seed_pos1[i], seed_pos2[i]), seed_params1[i], seed_params2[i]);
+        CCI_STAT_INC(seeds);
         pre = ret;
     }
 
@@ -5856,14 +6591,883 @@ curve_curve_int* nurbs_nurbs_near_inters(bs3_curve nurbs1, bs3_curve nurbs2, SPA
     return ret;
 }
 
-// 获得区间range去除exclude_ranges后的集合
-void interval_exclude(SPAinterval const& range, std::vector<SPAinterval> const& exclude_ranges, std::vector<SPAinterval>& left_ranges) {
-    std::vector<std::pair<double, int>> interval;             // (val, label)
-    interval.push_back(std::make_pair(range.start_pt(), 0));  // 0代表端点
-    interval.push_back(std::make_pair(range.end_pt(), 0));
-    for(auto const& exclude_range: exclude_ranges) {
-        interval.push_back(std::make_pair(exclude_range.start_pt(), 1));  // 1代表start
-        interval.push_back(std::make_pair(exclude_range.end_pt(), 2));    // 2代表end
+/**
+ * @brief 将nurbs曲线分解为有理Bezier曲线段
+ * @return 分解成功返回true；曲线阶数超过CCI_BEZIER_MAX_ORDER时返回false
+ * @param nurbs 输入的nurbs曲线
+ * @param beziers 输出的Bezier曲线段，参数区间与nurbs的参数一致
+ */
+bool cci_nurbs_to_beziers(bs3_curve nurbs, std::vector<CciBezier>& beziers) {
+    beziers.clear();
+    NurbsBezierSpans spans;
+    if(!nurbs || bs3_curve_degree(nurbs) + 1 > CCI_BEZIER_MAX_ORDER || !NurbscToBezierSpans(nurbs, spans)) {
+        return false;
+    }
+    int order = spans.degree + 1;
+    beziers.resize(spans.num_spans);
+    for(int i = 0; i < spans.num_spans; ++i) {
+        CciBezier& bez = beziers[i];
+        bez.degree = spans.degree;
+        bez.t0 = spans.t[i];
+        bez.t1 = spans.t[i + 1];
+        for(int k = 0; k < order; ++k) {
+            bez.pts[k][0] = spans.x[i * order + k];
+            bez.pts[k][1] = spans.y[i * order + k];
+            bez.pts[k][2] = spans.z[i * order + k];
+            bez.pts[k][3] = spans.w[i * order + k];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief de Casteljau算法在局部参数s处将Bezier曲线分为两段
+ */
+void cci_bezier_split(CciBezier const& bez, double s, CciBezier& left, CciBezier& right) {
+    int n = bez.degree;
+    double t0 = bez.t0, t1 = bez.t1;
+    double tmp[CCI_BEZIER_MAX_ORDER][4];
+    std::copy(&bez.pts[0][0], &bez.pts[0][0] + (n + 1) * 4, &tmp[0][0]);
+    left.degree = right.degree = n;
+    for(int k = 0; k < 4; ++k) {
+        left.pts[0][k] = tmp[0][k];
+        right.pts[n][k] = tmp[n][k];
+    }
+    for(int r = 1; r <= n; ++r) {
+        for(int i = 0; i <= n - r; ++i) {
+            for(int k = 0; k < 4; ++k) {
+                tmp[i][k] = (1.0 - s) * tmp[i][k] + s * tmp[i + 1][k];
+            }
+        }
+        for(int k = 0; k < 4; ++k) {
+            left.pts[r][k] = tmp[0][k];
+            right.pts[n - r][k] = tmp[n - r][k];
+        }
+    }
+    double tm = t0 + s * (t1 - t0);
+    left.t0 = t0;
+    left.t1 = tm;
+    right.t0 = tm;
+    right.t1 = t1;
+}
+
+/**
+ * @brief 获得Bezier曲线在局部参数区间[a, b]上的子曲线
+ */
+void cci_bezier_sub(CciBezier const& bez, double a, double b, CciBezier& sub, CciBezierOps const* ops) {
+    auto split = ops ? ops->split : cci_bezier_split;
+    CciBezier left, right;
+    if(b < 1.0) {
+        split(bez, b, left, right);
+    } else {
+        left = bez;
+    }
+    if(a > 0.0 && b > 0.0) {
+        split(left, a / b, right, sub);
+    } else {
+        sub = left;
+    }
+}
+
+/**
+ * @brief 计算Bezier曲线在局部参数s处的位置和一阶导数(对局部参数)
+ */
+void cci_bezier_eval(CciBezier const& bez, double s, SPAposition& pos, SPAvector& deriv) {
+    int n = bez.degree;
+    double tmp[CCI_BEZIER_MAX_ORDER][4];
+    std::copy(&bez.pts[0][0], &bez.pts[0][0] + (n + 1) * 4, &tmp[0][0]);
+    for(int r = 1; r < n; ++r) {
+        for(int i = 0; i <= n - r; ++i) {
+            for(int k = 0; k < 4; ++k) {
+                tmp[i][k] = (1.0 - s) * tmp[i][k] + s * tmp[i + 1][k];
+            }
+        }
+    }
+    // 齐次坐标下的位置h与导数dh，再由商的求导法则得到欧氏空间的导数
+    double h[4], dh[4];
+    for(int k = 0; k < 4; ++k) {
+        h[k] = (1.0 - s) * tmp[0][k] + s * tmp[1][k];
+        dh[k] = n * (tmp[1][k] - tmp[0][k]);
+    }
+    pos = SPAposition(h[0] / h[3], h[1] / h[3], h[2] / h[3]);
+    deriv = SPAvector((dh[0] - pos.x() * dh[3]) / h[3], (dh[1] - pos.y() * dh[3]) / h[3], (dh[2] - pos.z() * dh[3]) / h[3]);
+}
+
+/**
+ * @brief 获得Bezier曲线控制多边形的包围盒
+ */
+SPAbox cci_bezier_box(CciBezier const& bez) {
+    double low[3] = {DBL_MAX, DBL_MAX, DBL_MAX};
+    double high[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+    for(int i = 0; i <= bez.degree; ++i) {
+        for(int k = 0; k < 3; ++k) {
+            double val = bez.pts[i][k] / bez.pts[i][3];
+            low[k] = std::min(low[k], val);
+            high[k] = std::max(high[k], val);
+        }
+    }
+    return SPAbox(SPAposition(low[0], low[1], low[2]), SPAposition(high[0], high[1], high[2]));
+}
+
+/**
+ * @brief 获得Bezier曲线齐次坐标多项式的导曲线(速端曲线)，次数减一；非有理曲线的导曲线权重为1
+ */
+void cci_bezier_hodograph(CciBezier const& bez, CciBezier& hodo) {
+    int n = bez.degree;
+    bool rational = false;
+    for(int i = 0; i <= n; ++i) {
+        rational = rational || bez.pts[i][3] != 1.0;
+    }
+    hodo.degree = std::max(n - 1, 0);
+    hodo.t0 = bez.t0;
+    hodo.t1 = bez.t1;
+    if(n == 0) {
+        std::fill(&hodo.pts[0][0], &hodo.pts[0][0] + 3, 0.0);
+        hodo.pts[0][3] = rational ? 0.0 : 1.0;
+        return;
+    }
+    for(int i = 0; i < n; ++i) {
+        for(int k = 0; k < 4; ++k) {
+            hodo.pts[i][k] = n * (bez.pts[i + 1][k] - bez.pts[i][k]);
+        }
+        if(!rational) {
+            hodo.pts[i][3] = 1.0;
+        }
+    }
+}
+
+template <int Degree, bool Rational> static constexpr CciBezierOps cci_bezier_kernel_ops() {
+    return {CciBezierKernel<Degree, Rational>::eval, CciBezierKernel<Degree, Rational>::split, CciBezierKernel<Degree, Rational>::box, CciBezierKernel<Degree, Rational>::hodograph};
+}
+
+CciBezierOps const& cci_bezier_ops(int degree, bool rational) {
+    static const CciBezierOps generic_ops = {cci_bezier_eval, cci_bezier_split, cci_bezier_box, cci_bezier_hodograph};
+    static const CciBezierOps kernel_ops[3][2] = {
+      {cci_bezier_kernel_ops<1, false>(), cci_bezier_kernel_ops<1, true>()},
+      {cci_bezier_kernel_ops<2, false>(), cci_bezier_kernel_ops<2, true>()},
+      {cci_bezier_kernel_ops<3, false>(), cci_bezier_kernel_ops<3, true>()}
+    };
+    if(degree < 1 || degree > 3) {
+        return generic_ops;
+    }
+    return kernel_ops[degree - 1][rational ? 1 : 0];
+}
+
+CciBezierOps const& cci_bezier_ops(std::vector<CciBezier> const& beziers) {
+    int degree = beziers.empty() ? 0 : beziers[0].degree;
+    bool rational = false;
+    for(auto const& bez: beziers) {
+        for(int i = 0; i <= degree && !rational; ++i) {
+            rational = bez.pts[i][3] != 1.0;
+        }
+    }
+    return cci_bezier_ops(degree, rational);
+}
+
+/**
+ * @brief CCI_EVAL_LANES个double组成的向量，AVX2下为__m256d
+ */
+#if defined(__AVX2__)
+struct CciLanes {
+    __m256d v;
+
+    static CciLanes load(double const* p) { return {_mm256_loadu_pd(p)}; }
+    static CciLanes fill(double x) { return {_mm256_set1_pd(x)}; }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+    friend CciLanes operator+(CciLanes a, CciLanes b) { return {_mm256_add_pd(a.v, b.v)}; }
+    friend CciLanes operator-(CciLanes a, CciLanes b) { return {_mm256_sub_pd(a.v, b.v)}; }
+    friend CciLanes operator*(CciLanes a, CciLanes b) { return {_mm256_mul_pd(a.v, b.v)}; }
+    friend CciLanes operator/(CciLanes a, CciLanes b) { return {_mm256_div_pd(a.v, b.v)}; }
+};
+#else
+struct CciLanes {
+    double v[CCI_EVAL_LANES];
+
+    static CciLanes load(double const* p) {
+        CciLanes r;
+        std::copy(p, p + CCI_EVAL_LANES, r.v);
+        return r;
+    }
+    static CciLanes fill(double x) {
+        CciLanes r;
+        std::fill(r.v, r.v + CCI_EVAL_LANES, x);
+        return r;
+    }
+    void store(double* p) const { std::copy(v, v + CCI_EVAL_LANES, p); }
+#define CCI_LANES_OP(op)                                       \
+    friend CciLanes operator op(CciLanes const& a, CciLanes const& b) { \
+        CciLanes r;                                            \
+        for(int l = 0; l < CCI_EVAL_LANES; ++l) {              \
+            r.v[l] = a.v[l] op b.v[l];                         \
+        }                                                      \
+        return r;                                              \
+    }
+    CCI_LANES_OP(+)
+    CCI_LANES_OP(-)
+    CCI_LANES_OP(*)
+    CCI_LANES_OP(/)
+#undef CCI_LANES_OP
+};
+#endif
+
+/**
+ * @brief 同时计算CCI_EVAL_LANES组Bezier曲线(次数相同)在局部参数处的位置和一阶、二阶导数
+ * @param degree Bezier曲线的次数
+ * @param ctrl 齐次控制点，ctrl[(k * 4 + c) * CCI_EVAL_LANES + l]为第l组第k个控制点的第c个分量
+ * @param s 各组的局部参数
+ * @param scale 各组局部参数对全局参数的导数
+ * @param out 输出，out[(j * 3 + c) * CCI_EVAL_LANES + l]为第l组的j阶导数(j = 0为位置)的第c个分量
+ */
+static void cci_bezier_eval_lanes(int degree, double const* ctrl, double const* s, double const* scale, double* out) {
+    CciLanes tmp[CCI_BEZIER_MAX_ORDER][4];
+    for(int k = 0; k <= degree; ++k) {
+        for(int c = 0; c < 4; ++c) {
+            tmp[k][c] = CciLanes::load(ctrl + (k * 4 + c) * CCI_EVAL_LANES);
+        }
+    }
+    CciLanes t = CciLanes::load(s), u = CciLanes::fill(1.0) - t;
+    // de Casteljau迭代到剩余三个控制点P0, P1, P2，由二次Bezier曲线得到位置和一、二阶导数
+    for(int r = 1; r <= degree - 2; ++r) {
+        for(int i = 0; i <= degree - r; ++i) {
+            for(int c = 0; c < 4; ++c) {
+                tmp[i][c] = u * tmp[i][c] + t * tmp[i + 1][c];
+            }
+        }
+    }
+    CciLanes zero = CciLanes::fill(0.0);
+    CciLanes h[4], dh[4], ddh[4];
+    for(int c = 0; c < 4; ++c) {
+        if(degree >= 2) {
+            CciLanes a = tmp[1][c] - tmp[0][c], b = tmp[2][c] - tmp[1][c];
+            h[c] = u * (u * tmp[0][c] + t * tmp[1][c]) + t * (u * tmp[1][c] + t * tmp[2][c]);
+            dh[c] = CciLanes::fill(degree) * (u * a + t * b);
+            ddh[c] = CciLanes::fill(degree * (degree - 1)) * (b - a);
+        } else if(degree == 1) {
+            h[c] = u * tmp[0][c] + t * tmp[1][c];
+            dh[c] = tmp[1][c] - tmp[0][c];
+            ddh[c] = zero;
+        } else {
+            h[c] = tmp[0][c];
+            dh[c] = ddh[c] = zero;
+        }
+    }
+    CciLanes k1 = CciLanes::load(scale), k2 = k1 * k1;
+    CciLanes w = h[3], dw = dh[3] * k1, ddw = ddh[3] * k2;
+    CciLanes two = CciLanes::fill(2.0);
+    for(int c = 0; c < 3; ++c) {
+        // 商的求导法则: p = h / w, p' = (h' - p w') / w, p'' = (h'' - 2 p' w' - p w'') / w
+        CciLanes p = h[c] / w;
+        CciLanes dp = (dh[c] * k1 - p * dw) / w;
+        CciLanes ddp = (ddh[c] * k2 - two * dp * dw - p * ddw) / w;
+        p.store(out + c * CCI_EVAL_LANES);
+        dp.store(out + (3 + c) * CCI_EVAL_LANES);
+        ddp.store(out + (6 + c) * CCI_EVAL_LANES);
+    }
+}
+
+bool CciBs3Evaluator::init(bs3_curve nurbs) {
+    std::vector<CciBezier> beziers;
+    bs3 = nurbs;
+    if(!cci_nurbs_to_beziers(nurbs, beziers)) {
+        breaks.clear();
+        pts.clear();
+        return false;
+    }
+    init(beziers);
+    return true;
+}
+
+void CciBs3Evaluator::init(std::vector<CciBezier> const& beziers) {
+    breaks.clear();
+    pts.clear();
+    if(beziers.empty()) {
+        return;
+    }
+    degree = beziers[0].degree;
+    breaks.reserve(beziers.size() + 1);
+    pts.reserve(beziers.size() * (degree + 1) * 4);
+    for(auto const& bez: beziers) {
+        breaks.push_back(bez.t0);
+        pts.insert(pts.end(), &bez.pts[0][0], &bez.pts[0][0] + (degree + 1) * 4);
+    }
+    breaks.push_back(beziers.back().t1);
+}
+
+void CciBs3Evaluator::eval(int n, double const* params, SPAposition* pos, SPAvector* d1, SPAvector* d2) const {
+    if(breaks.empty()) {
+        for(int i = 0; i < n; ++i) {
+            SPAposition p;
+            SPAvector v1, v2;
+            bs3_curve_eval(params[i], bs3, p, v1, v2);
+            pos[i] = p;
+            if(d1) d1[i] = v1;
+            if(d2) d2[i] = v2;
+        }
+        return;
+    }
+    int order = degree + 1;
+    int num_spans = static_cast<int>(breaks.size()) - 1;
+    double ctrl[CCI_BEZIER_MAX_ORDER * 4 * CCI_EVAL_LANES];
+    double s[CCI_EVAL_LANES], scale[CCI_EVAL_LANES], out[9 * CCI_EVAL_LANES];
+    for(int first = 0; first < n; first += CCI_EVAL_LANES) {
+        int count = std::min(CCI_EVAL_LANES, n - first);
+        for(int l = 0; l < CCI_EVAL_LANES; ++l) {
+            // 不足一组时重复最后一个参数补齐
+            double t = params[first + std::min(l, count - 1)];
+            int span = static_cast<int>(std::upper_bound(breaks.begin() + 1, breaks.end() - 1, t) - breaks.begin()) - 1;
+            span = std::clamp(span, 0, num_spans - 1);
+            double len = breaks[span + 1] - breaks[span];
+            s[l] = (t - breaks[span]) / len;
+            scale[l] = 1.0 / len;
+            double const* src = pts.data() + span * order * 4;
+            for(int k = 0; k < order * 4; ++k) {
+                ctrl[k * CCI_EVAL_LANES + l] = src[k];
+            }
+        }
+        cci_bezier_eval_lanes(degree, ctrl, s, scale, out);
+        for(int l = 0; l < count; ++l) {
+            auto at = [&out, l](int j, int c) { return out[(j * 3 + c) * CCI_EVAL_LANES + l]; };
+            pos[first + l] = SPAposition(at(0, 0), at(0, 1), at(0, 2));
+            if(d1) d1[first + l] = SPAvector(at(1, 0), at(1, 1), at(1, 2));
+            if(d2) d2[first + l] = SPAvector(at(2, 0), at(2, 1), at(2, 2));
+        }
+    }
+}
+
+std::vector<SPAposition> CciBs3Evaluator::positions(std::vector<double> const& params) const {
+    std::vector<SPAposition> result(params.size());
+    eval(static_cast<int>(params.size()), params.data(), result.data());
+    return result;
+}
+
+void CciSegmentArray::clear() {
+    for(auto* coords: {&x0, &y0, &z0, &x1, &y1, &z1}) {
+        coords->clear();
+    }
+}
+
+void CciSegmentArray::reserve(int n) {
+    for(auto* coords: {&x0, &y0, &z0, &x1, &y1, &z1}) {
+        coords->reserve(n);
+    }
+}
+
+void CciSegmentArray::push_back(SPAposition const& start, SPAposition const& end) {
+    x0.push_back(start.x());
+    y0.push_back(start.y());
+    z0.push_back(start.z());
+    x1.push_back(end.x());
+    y1.push_back(end.y());
+    z1.push_back(end.z());
+}
+
+void CciSegmentArray::assign_polyline(std::vector<SPAposition> const& pts, bool closed) {
+    clear();
+    int n = static_cast<int>(pts.size());
+    if(n < 2) {
+        return;
+    }
+    reserve(closed ? n : n - 1);
+    for(int i = 0; i + 1 < n; ++i) {
+        push_back(pts[i], pts[i + 1]);
+    }
+    if(closed) {
+        push_back(pts[n - 1], pts[0]);
+    }
+}
+
+/**
+ * @brief 与直线平行的线段: 在容差内位于直线上时输出重合部分的两个端点
+ */
+static void cci_parallel_segment_hits(SPAposition const& root, SPAvector const& dir, double tlo, double thi, int index, SPAposition const& a, SPAposition const& b, std::vector<CciSegmentHit>& hits, double tol) {
+    double dd = dir % dir;
+    if(((a - root) * dir).len() > tol * sqrt(dd)) {
+        return;
+    }
+    double ta = ((a - root) % dir) / dd, tb = ((b - root) % dir) / dd;
+    double lo = std::max(std::min(ta, tb), tlo), hi = std::min(std::max(ta, tb), thi);
+    if(lo > hi) {
+        return;
+    }
+    // 退化为一点的线段参数取0
+    auto seg_param = [ta, tb](double t) { return fabs(tb - ta) > SPAresmch ? std::clamp((t - ta) / (tb - ta), 0.0, 1.0) : 0.0; };
+    hits.push_back({index, lo, seg_param(lo), root + lo * dir, true});
+    if((hi - lo) * sqrt(dd) > tol) {
+        hits.push_back({index, hi, seg_param(hi), root + hi * dir, true});
+    }
+}
+
+void cci_line_segments_int(SPAposition const& root, SPAvector const& dir, SPAinterval const& range, CciSegmentArray const& segs, std::vector<CciSegmentHit>& hits, double tol) {
+    hits.clear();
+    int n = segs.size();
+    double dd = dir % dir;
+    if(n == 0 || dd <= SPAresmch) {
+        return;
+    }
+    double dlen = sqrt(dd);
+    double tlo = range.bounded_below() ? range.start_pt() - tol / dlen : -DBL_MAX;
+    double thi = range.bounded_above() ? range.end_pt() + tol / dlen : DBL_MAX;
+    CciLanes rx = CciLanes::fill(root.x()), ry = CciLanes::fill(root.y()), rz = CciLanes::fill(root.z());
+    CciLanes dx = CciLanes::fill(dir.x()), dy = CciLanes::fill(dir.y()), dz = CciLanes::fill(dir.z());
+    double const* coords[6] = {segs.x0.data(), segs.y0.data(), segs.z0.data(), segs.x1.data(), segs.y1.data(), segs.z1.data()};
+    double pad[6][CCI_EVAL_LANES];
+    double t_out[CCI_EVAL_LANES], s_out[CCI_EVAL_LANES], den_out[CCI_EVAL_LANES], ee_out[CCI_EVAL_LANES], dist_out[CCI_EVAL_LANES];
+    for(int first = 0; first < n; first += CCI_EVAL_LANES) {
+        int count = std::min(CCI_EVAL_LANES, n - first);
+        CciLanes c[6];
+        for(int k = 0; k < 6; ++k) {
+            if(count == CCI_EVAL_LANES) {
+                c[k] = CciLanes::load(coords[k] + first);
+            } else {
+                // 不足一组时重复最后一条线段补齐
+                for(int l = 0; l < CCI_EVAL_LANES; ++l) {
+                    pad[k][l] = coords[k][first + std::min(l, count - 1)];
+                }
+                c[k] = CciLanes::load(pad[k]);
+            }
+        }
+        // 线段方向e，起点相对直线的偏移w，直线参数t = ((w x e) . m) / |m|^2，线段参数s = ((w x d) . m) / |m|^2，其中m = d x e
+        CciLanes ex = c[3] - c[0], ey = c[4] - c[1], ez = c[5] - c[2];
+        CciLanes wx = c[0] - rx, wy = c[1] - ry, wz = c[2] - rz;
+        CciLanes mx = dy * ez - dz * ey, my = dz * ex - dx * ez, mz = dx * ey - dy * ex;
+        CciLanes den = mx * mx + my * my + mz * mz;
+        CciLanes t = ((wy * ez - wz * ey) * mx + (wz * ex - wx * ez) * my + (wx * ey - wy * ex) * mz) / den;
+        CciLanes s = ((wy * dz - wz * dy) * mx + (wz * dx - wx * dz) * my + (wx * dy - wy * dx) * mz) / den;
+        // 两条直线最近点的距离
+        CciLanes px = wx + s * ex - t * dx, py = wy + s * ey - t * dy, pz = wz + s * ez - t * dz;
+        (px * px + py * py + pz * pz).store(dist_out);
+        (ex * ex + ey * ey + ez * ez).store(ee_out);
+        den.store(den_out);
+        t.store(t_out);
+        s.store(s_out);
+        for(int l = 0; l < count; ++l) {
+            int i = first + l;
+            if(den_out[l] <= SPAresnor * SPAresnor * dd * ee_out[l]) {
+                cci_parallel_segment_hits(root, dir, tlo, thi, i, SPAposition(coords[0][i], coords[1][i], coords[2][i]), SPAposition(coords[3][i], coords[4][i], coords[5][i]), hits, tol);
+                continue;
+            }
+            double stol = tol / sqrt(ee_out[l]);
+            if(t_out[l] < tlo || t_out[l] > thi || s_out[l] < -stol || s_out[l] > 1 + stol || dist_out[l] > tol * tol) {
+                continue;
+            }
+            hits.push_back({i, t_out[l], std::clamp(s_out[l], 0.0, 1.0), root + t_out[l] * dir, false});
+        }
+    }
+    std::sort(hits.begin(), hits.end(), [](CciSegmentHit const& a, CciSegmentHit const& b) { return a.param < b.param || (a.param == b.param && a.index < b.index); });
+}
+
+void cci_straight_segments_int(straight const& st, CciSegmentArray const& segs, std::vector<CciSegmentHit>& hits, double tol) {
+    cci_line_segments_int(st.root_point, st.direction * st.param_scale, st.param_range(), segs, hits, tol);
+}
+
+/**
+ * @brief 控制值为c的Bernstein多项式，其控制多边形凸包与非负半平面相交部分的参数区间
+ * @return 凸包全部在负半平面时返回false
+ * @param degree 多项式的次数
+ * @param c 控制值，第j个控制点为(j/degree, c[j])
+ * @param lo
+ * @param hi [lo, hi]为多项式可能非负的参数区间
+ */
+bool cci_hull_nonneg_range(int degree, double const* c, double& lo, double& hi) {
+    lo = DBL_MAX;
+    hi = -DBL_MAX;
+    for(int j = 0; j <= degree; ++j) {
+        if(c[j] < 0.0) {
+            continue;
+        }
+        lo = std::min(lo, (double)j / degree);
+        hi = std::max(hi, (double)j / degree);
+        // 凸包边界与x轴的交点必为某个负控制点与非负控制点连线与x轴的交点
+        for(int i = 0; i <= degree; ++i) {
+            if(c[i] >= 0.0) {
+                continue;
+            }
+            double x = (i + (j - i) * c[i] / (c[i] - c[j])) / degree;
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+        }
+    }
+    return lo <= hi;
+}
+
+/**
+ * @brief 控制多边形有向包围盒的轴: 弦方向u，控制点偏离弦最远的方向n1，以及n2 = u * n1；弦退化时取离首控制点最远的方向
+ */
+void cci_polygon_axes(SPAposition const* p, int num, SPAunit_vector axes[3]) {
+    int n = num - 1;
+    SPAvector u = p[n] - p[0];
+    if(u.len() <= SPAresmch) {
+        for(int i = 1; i <= n; ++i) {
+            if((p[i] - p[0]).len() > u.len()) {
+                u = p[i] - p[0];
+            }
+        }
+    }
+    axes[0] = u.len() > SPAresmch ? normalise(u) : SPAunit_vector(1, 0, 0);
+    SPAvector n1(0, 0, 0);
+    for(int i = 1; i <= n; ++i) {
+        SPAvector perp = (p[i] - p[0]) - ((p[i] - p[0]) % axes[0]) * axes[0];
+        if(perp.len() > n1.len()) {
+            n1 = perp;
+        }
+    }
+    if(n1.len() > SPAresmch) {
+        axes[1] = normalise(n1);
+        axes[2] = normalise(axes[0] * axes[1]);
+    } else {
+        compute_axes_from_z(axes[0], axes[1], axes[2]);
+    }
+}
+
+void cci_bezier_hull(std::vector<CciBezier> const& beziers, SPAinterval const& range, std::vector<SPAposition>& hull) {
+    hull.clear();
+    if(beziers.empty()) {
+        return;
+    }
+    CciBezierOps const& ops = cci_bezier_ops(beziers);
+    double a = range.start_pt(), b = range.end_pt();
+    // 第一个结束点大于a的Bezier曲线段
+    auto first = std::upper_bound(beziers.begin(), beziers.end(), a, [](double t, CciBezier const& bez) { return t < bez.t1; });
+    for(auto it = first == beziers.end() ? first - 1 : first; it != beziers.end() && it->t0 < b; ++it) {
+        double len = it->t1 - it->t0;
+        double sa = std::clamp((a - it->t0) / len, 0.0, 1.0), sb = std::clamp((b - it->t0) / len, 0.0, 1.0);
+        CciBezier sub;
+        if(sa > 0.0 || sb < 1.0) {
+            cci_bezier_sub(*it, sa, sb, sub, &ops);
+        } else {
+            sub = *it;
+        }
+        for(int k = 0; k <= sub.degree; ++k) {
+            hull.push_back(SPAposition(sub.pts[k][0] / sub.pts[k][3], sub.pts[k][1] / sub.pts[k][3], sub.pts[k][2] / sub.pts[k][3]));
+        }
+    }
+}
+
+bool cci_hulls_separated(std::vector<SPAposition> const& hull1, std::vector<SPAposition> const& hull2, double tol) {
+    if(hull1.empty() || hull2.empty()) {
+        return false;
+    }
+    SPAunit_vector axes[13];
+    int num_axes = 0;
+    cci_polygon_axes(hull1.data(), static_cast<int>(hull1.size()), axes);
+    cci_polygon_axes(hull2.data(), static_cast<int>(hull2.size()), axes + 3);
+    num_axes = 6;
+    // 两个弦方向的叉积: 两段近似直线的曲线异面时的分离轴
+    SPAvector cross = axes[0] * axes[3];
+    if(cross.len() > SPAresnor) {
+        axes[num_axes++] = normalise(cross);
+    }
+    axes[num_axes++] = SPAunit_vector(1, 0, 0);
+    axes[num_axes++] = SPAunit_vector(0, 1, 0);
+    axes[num_axes++] = SPAunit_vector(0, 0, 1);
+    SPAvector c(0, 0, 0);
+    for(auto const& pt: hull2) {
+        c += (pt - hull1[0]) / static_cast<double>(hull2.size());
+    }
+    for(auto const& pt: hull1) {
+        c -= (pt - hull1[0]) / static_cast<double>(hull1.size());
+    }
+    if(c.len() > SPAresmch) {
+        axes[num_axes++] = normalise(c);
+    }
+    for(int k = 0; k < num_axes; ++k) {
+        double min1 = DBL_MAX, max1 = -DBL_MAX, min2 = DBL_MAX, max2 = -DBL_MAX;
+        for(auto const& pt: hull1) {
+            double d = (pt - hull1[0]) % axes[k];
+            min1 = std::min(min1, d);
+            max1 = std::max(max1, d);
+        }
+        for(auto const& pt: hull2) {
+            double d = (pt - hull1[0]) % axes[k];
+            min2 = std::min(min2, d);
+            max2 = std::max(max2, d);
+        }
+        if(min2 > max1 + tol || min1 > max2 + tol) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cci_bs3_hulls_separated(bs3_curve bs1, bs3_curve bs2, double tol) {
+    if(!bs1 || !bs2) {
+        return false;
+    }
+    SPAposition *ctrlpts1 = nullptr, *ctrlpts2 = nullptr;
+    int num1 = 0, num2 = 0;
+    bs3_curve_control_points(bs1, num1, ctrlpts1);
+    bs3_curve_control_points(bs2, num2, ctrlpts2);
+    std::vector<SPAposition> hull1(ctrlpts1, ctrlpts1 + num1), hull2(ctrlpts2, ctrlpts2 + num2);
+    ACIS_DELETE[] ctrlpts1;
+    ACIS_DELETE[] ctrlpts2;
+    return cci_hulls_separated(hull1, hull2, tol);
+}
+
+/**
+ * @brief 以fat的控制多边形的有向包围盒(弦方向及其两个法向的平板)裁剪bez的参数区间
+ * @return bez与平板无交时返回false
+ * @param fat 用于构造平板的Bezier曲线
+ * @param bez 被裁剪的Bezier曲线
+ * @param tol 平板加厚的容差
+ * @param smin
+ * @param smax [smin, smax]为bez裁剪后保留的局部参数区间
+ */
+bool cci_bezier_clip(CciBezier const& fat, CciBezier const& bez, double tol, double& smin, double& smax) {
+    int n = fat.degree, m = bez.degree;
+    SPAposition p[CCI_BEZIER_MAX_ORDER], q[CCI_BEZIER_MAX_ORDER];
+    for(int i = 0; i <= n; ++i) {
+        p[i] = SPAposition(fat.pts[i][0] / fat.pts[i][3], fat.pts[i][1] / fat.pts[i][3], fat.pts[i][2] / fat.pts[i][3]);
+    }
+    for(int j = 0; j <= m; ++j) {
+        q[j] = SPAposition(bez.pts[j][0] / bez.pts[j][3], bez.pts[j][1] / bez.pts[j][3], bez.pts[j][2] / bez.pts[j][3]);
+    }
+
+    SPAunit_vector axes[3];
+    cci_polygon_axes(p, n + 1, axes);
+
+    smin = 0.0;
+    smax = 1.0;
+    for(int k = 0; k < 3; ++k) {
+        double dmin = DBL_MAX, dmax = -DBL_MAX;
+        for(int i = 0; i <= n; ++i) {
+            double d = (p[i] - p[0]) % axes[k];
+            dmin = std::min(dmin, d);
+            dmax = std::max(dmax, d);
+        }
+        dmin -= 0.5 * tol;
+        dmax += 0.5 * tol;
+        // 权重为正，距离函数与平板的关系由分子 sum(w_j * (e_j - dmin) * B_j) 的符号决定
+        double lo_coef[CCI_BEZIER_MAX_ORDER], hi_coef[CCI_BEZIER_MAX_ORDER];
+        for(int j = 0; j <= m; ++j) {
+            double e = (q[j] - p[0]) % axes[k];
+            lo_coef[j] = bez.pts[j][3] * (e - dmin);
+            hi_coef[j] = bez.pts[j][3] * (dmax - e);
+        }
+        double lo1 = 0.0, hi1 = 0.0, lo2 = 0.0, hi2 = 0.0;
+        if(!cci_hull_nonneg_range(m, lo_coef, lo1, hi1) || !cci_hull_nonneg_range(m, hi_coef, lo2, hi2)) {
+            return false;
+        }
+        smin = std::max(smin, std::max(lo1, lo2));
+        smax = std::min(smax, std::min(hi1, hi2));
+        if(smin > smax) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gauss-Newton迭代求精两条Bezier曲线上最近点的局部参数
+ * @param a Bezier曲线1
+ * @param b Bezier曲线2
+ * @param s1 a的局部参数，输入初值，输出求精结果
+ * @param s2 b的局部参数，输入初值，输出求精结果
+ * @param ops1 a的求值内核，为nullptr时使用通用实现
+ * @param ops2 b的求值内核，为nullptr时使用通用实现
+ */
+void cci_bezier_polish(CciBezier const& a, CciBezier const& b, double& s1, double& s2, CciBezierOps const* ops1, CciBezierOps const* ops2) {
+    auto eval1 = ops1 ? ops1->eval : cci_bezier_eval;
+    auto eval2 = ops2 ? ops2->eval : cci_bezier_eval;
+    for(int iter = 0; iter < 4; ++iter) {
+        SPAposition pa, pb;
+        SPAvector da, db;
+        eval1(a, s1, pa, da);
+        eval2(b, s2, pb, db);
+        // 最小化 |(pa - pb) + da * ds1 - db * ds2|^2 的法方程
+        SPAvector r = pa - pb;
+        double a11 = da % da, a12 = -(da % db), a22 = db % db;
+        double b1 = -(da % r), b2 = db % r;
+        double det = a11 * a22 - a12 * a12;
+        if(fabs(det) <= 1e-12 * a11 * a22) {  // 两切线近似平行(相切)，不求精
+            break;
+        }
+        double ds1 = (b1 * a22 - a12 * b2) / det;
+        double ds2 = (a11 * b2 - a12 * b1) / det;
+        s1 = std::clamp(s1 + ds1, 0.0, 1.0);
+        s2 = std::clamp(s2 + ds2, 0.0, 1.0);
+        if(fabs(ds1) <= SPAresmch && fabs(ds2) <= SPAresmch) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Bezier裁剪求两个nurbs曲线的交点，横截交点二次收敛至容差内，相切等无法收敛的单元作为近似交点交给MAF求精
+ * @param nurbs1 nurbs曲线1
+ * @param nurbs2 nurbs曲线2
+ * @param tol 求交容差
+ * @param inters 输出收敛的交点，参数为nurbs曲线上的参数
+ * @param seeds 输出未能收敛的近似交点，需要调用curve_curve_maf求精
+ */
+void bezier_clip_nurbs_inters(bs3_curve nurbs1, bs3_curve nurbs2, double tol, curve_curve_int*& inters, curve_curve_int*& seeds, std::vector<CciBezier> const* beziers1, std::vector<CciBezier> const* beziers2,
+                              std::vector<SPAbox> const* boxes1, std::vector<SPAbox> const* boxes2) {
+    inters = nullptr;
+    seeds = nullptr;
+    if(!nurbs1 || !nurbs2) {
+        return;
+    }
+    tol = std::max(tol, (double)SPAresabs);
+    CCI_STAT_TIMER(bezier_clip);
+    std::vector<CciBezier> local1, local2;
+    if(!beziers1 && cci_nurbs_to_beziers(nurbs1, local1)) {
+        beziers1 = &local1;
+        boxes1 = nullptr;
+    }
+    if(!beziers2 && cci_nurbs_to_beziers(nurbs2, local2)) {
+        beziers2 = &local2;
+        boxes2 = nullptr;
+    }
+    if(!beziers1 || !beziers2) {
+        // 无法分解为Bezier曲线段时退回包围盒细分
+        seeds = nurbs_nurbs_near_inters(nurbs1, nurbs2, bs3_curve_range(nurbs1), bs3_curve_range(nurbs2), tol);
+        return;
+    }
+    // 每条曲线的所有Bezier曲线段次数和有理性相同，在此选择一次内核
+    CciBezierOps const& ops1 = cci_bezier_ops(*beziers1);
+    CciBezierOps const& ops2 = cci_bezier_ops(*beziers2);
+
+    struct CciClipCell {
+        CciBezier a, b;
+        int depth;
+        double stall_size;  // 单元尺寸小于该值且裁剪停滞时，视为相切或重合
+    };
+    std::vector<CciClipCell> cells;
+    // 未给出曲线段包围盒时在此计算
+    std::vector<SPAbox> local_boxes1, local_boxes2;
+    if(!boxes1) {
+        for(auto const& a: *beziers1) {
+            local_boxes1.push_back(ops1.box(a));
+        }
+        boxes1 = &local_boxes1;
+    }
+    if(!boxes2) {
+        for(auto const& b: *beziers2) {
+            local_boxes2.push_back(ops2.box(b));
+        }
+        boxes2 = &local_boxes2;
+    }
+    for(size_t i = 0; i < beziers1->size(); ++i) {
+        CciBezier const& a = (*beziers1)[i];
+        SPAbox const& box_a = (*boxes1)[i];
+        SPAbox fat_a = enlarge_box(box_a, tol);
+        for(size_t j = 0; j < beziers2->size(); ++j) {
+            CciBezier const& b = (*beziers2)[j];
+            SPAbox const& box_b = (*boxes2)[j];
+            if(fat_a && box_b) {
+                double size = std::max((box_a.high() - box_a.low()).len(), (box_b.high() - box_b.low()).len());
+                cells.push_back({a, b, 0, 1e-3 * size});
+            }
+        }
+    }
+
+    const int max_depth = 16;    // 细分超过该深度(相切、重合等)时交给MAF求精
+    const int max_cells = 4096;  // 处理的单元总数上限
+    const int max_clips = 32;    // 每个单元的裁剪次数上限
+    int num_cells = 0;
+    while(!cells.empty()) {
+        CciClipCell cell = cells.back();
+        cells.pop_back();
+        CciBezier& a = cell.a;
+        CciBezier& b = cell.b;
+        if(cell.depth > max_depth || ++num_cells > max_cells) {
+            seeds = cci_new_inter(seeds, SPAposition(0, 0, 0), 0.5 * (a.t0 + a.t1), 0.5 * (b.t0 + b.t1));
+            CCI_STAT_INC(seeds);
+            continue;
+        }
+
+        bool disjoint = false, converged = false;
+        for(int iter = 0; iter < max_clips; ++iter) {
+            SPAbox box_a = ops1.box(a), box_b = ops2.box(b);
+            if(!(enlarge_box(box_a, tol) && box_b)) {
+                disjoint = true;
+                break;
+            }
+            if((box_a.high() - box_a.low()).len() <= tol && (box_b.high() - box_b.low()).len() <= tol) {
+                converged = true;
+                break;
+            }
+            double smin = 0.0, smax = 1.0;
+            CciBezier sub;
+            if(!cci_bezier_clip(a, b, tol, smin, smax)) {
+                disjoint = true;
+                break;
+            }
+            double ratio_b = smax - smin;
+            cci_bezier_sub(b, smin, smax, sub, &ops2);
+            b = sub;
+            if(!cci_bezier_clip(b, a, tol, smin, smax)) {
+                disjoint = true;
+                break;
+            }
+            double ratio_a = smax - smin;
+            cci_bezier_sub(a, smin, smax, sub, &ops1);
+            a = sub;
+            if(ratio_a > 0.8 && ratio_b > 0.8) {
+                // 平板加厚了容差，横截交点处的单元只能收敛到容差量级，此时由牛顿迭代求精；否则单元内存在多个交点或相切，需要细分
+                SPAbox clip_box_a = ops1.box(a), clip_box_b = ops2.box(b);
+                converged = (clip_box_a.high() - clip_box_a.low()).len() <= 16 * tol && (clip_box_b.high() - clip_box_b.low()).len() <= 16 * tol;
+                break;
+            }
+        }
+        if(disjoint) {
+            continue;
+        }
+        if(converged) {
+            double s1 = 0.5, s2 = 0.5;
+            cci_bezier_polish(a, b, s1, s2, &ops1, &ops2);
+            SPAposition pa, pb;
+            SPAvector da, db;
+            ops1.eval(a, s1, pa, da);
+            ops2.eval(b, s2, pb, db);
+            double param1 = a.t0 + s1 * (a.t1 - a.t0);
+            double param2 = b.t0 + s2 * (b.t1 - b.t0);
+            if(distance_to_point(pa, pb) > tol) {  // 近似相切的单元由MAF判断是否相交
+                seeds = cci_new_inter(seeds, SPAposition(0, 0, 0), param1, param2);
+                CCI_STAT_INC(seeds);
+                continue;
+            }
+            inters = cci_new_inter(inters, mid_point(pa, pb), param1, param2);
+            if(biparallel(normalise(da), normalise(db))) {
+                inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_tangent;
+            } else {
+                inters->low_rel = inters->high_rel = curve_curve_rel::cur_cur_normal;
+            }
+            continue;
+        }
+
+        // 单元已很小但裁剪停滞，通常为相切，继续细分会产生大量单元，交给MAF求精
+        SPAbox box_a = ops1.box(a), box_b = ops2.box(b);
+        double extent_a = (box_a.high() - box_a.low()).len(), extent_b = (box_b.high() - box_b.low()).len();
+        if(extent_a <= cell.stall_size && extent_b <= cell.stall_size) {
+            seeds = cci_new_inter(seeds, SPAposition(0, 0, 0), 0.5 * (a.t0 + a.t1), 0.5 * (b.t0 + b.t1));
+            CCI_STAT_INC(seeds);
+            continue;
+        }
+        // 细分空间尺寸较大的曲线
+        CciBezier left, right;
+        if(extent_a >= extent_b) {
+            ops1.split(a, 0.5, left, right);
+            cells.push_back({left, b, cell.depth + 1, cell.stall_size});
+            cells.push_back({right, b, cell.depth + 1, cell.stall_size});
+        } else {
+            ops2.split(b, 0.5, left, right);
+            cells.push_back({a, left, cell.depth + 1, cell.stall_size});
+            cells.push_back({a, right, cell.depth + 1, cell.stall_size});
+        }
+    }
+
+    // 相邻Bezier段或细分单元公共端点处的交点去重
+    CurvCurvIntPointReduce(inters);
+}
+
+// 获得区间range去除exclude_ranges后的集合
+void interval_exclude(SPAinterval const& range, std::vector<SPAinterval> const& exclude_ranges, std::vector<SPAinterval>& left_ranges) {
+    std::vector<std::pair<double, int>> interval;             // (val, label)
+    interval.push_back(std::make_pair(range.start_pt(), 0));  // 0代表端点
+    interval.push_back(std::make_pair(range.end_pt(), 0));
+    for(auto const& exclude_range: exclude_ranges) {
+        interval.push_back(std::make_pair(exclude_range.start_pt(), 1));  // 1代表start
+        interval.push_back(std::make_pair(exclude_range.end_pt(), 2));    // 2代表end
     }
     std::sort(interval.begin(), interval.end());
     left_ranges.clear();
@@ -5943,7 +7547,7 @@ bool circle_circle_closest_points(ellipse const& cir1, ellipse const& cir2, std:
     inters = int_cur_cur(cir1, cir2, *(SPAbox*)nullptr, 1e-16);  // 1e-15
     API_END
     if(inters && inters->next && (inters->low_rel == curve_curve_rel::cur_cur_coin || inters->high_rel == curve_curve_rel::cur_cur_coin)) {
-        delete_curve_curve_ints(inters);
+        cci_delete_inters(inters);
         return true;
     }
     for(auto inters_tmp = inters; inters_tmp; inters_tmp = inters_tmp->next) {
@@ -5951,7 +7555,7 @@ bool circle_circle_closest_points(ellipse const& cir1, ellipse const& cir2, std:
         pos2_array.push_back(inters_tmp->int_point);
     }
     if(inters) {
-        delete_curve_curve_ints(inters);
+        cci_delete_inters(inters);
     } else {
         if(biparallel(cir1.normal, cir2.normal) && (is_equal(cir1.centre, cir2.centre) || perpendicular(cir1.centre - cir2.centre, cir1.normal))) {
             // coplanar
@@ -6002,7 +7606,7 @@ void line_circle_closest_points(straight const& line, ellipse const& cir, std::v
         if(inters->next) {
             pos1_array.push_back(inters->next->int_point), pos2_array.push_back(inters->next->int_point);
         }
-        delete_curve_curve_ints(inters);
+        cci_delete_inters(inters);
     } else {
         if(perpendicular(cir.normal, line.direction) && (is_equal(cir.centre, line.root_point) || perpendicular(cir.centre - line.root_point, cir.normal))) {
             // coplanar
@@ -6181,15 +7785,15 @@ int validate_coin_result(curve const& cur1, curve const& cur2, std::vector<SPAin
             coins = coins->next->next;
         } else {
             auto next = coins->next->next;
-            ACIS_DELETE coins->next;
-            ACIS_DELETE coins;
+            cci_delete_inter(coins->next);
+            cci_delete_inter(coins);
             coins = next;
         }
     }
     coin_ints1.erase(coin_ints1.begin() + num_coin_segs, coin_ints1.end());
     coin_ints2.erase(coin_ints2.begin() + num_coin_segs, coin_ints2.end());
     coins = head->next;
-    ACIS_DELETE head;
+    cci_delete_inter(head);
     return num_coin_segs;
 }
 
@@ -6249,65 +7853,11 @@ bool is_degenerate(curve const& cur) {
  * @param pt2
  */
 logical MinDistancePointPair(straight const& cci_straight, helix const& cci_helix, SPAposition const& init_pos, SPAposition& pt1, SPAposition& pt2) {
-    // 不检查输入是否为圆柱螺旋线，需要外部确认
-    //
-    // 螺旋线的局部坐标系
-    SPAposition helix_center = cci_helix.axis_root();
-    SPAunit_vector helix_vx = cci_helix.maj_dir();
-    SPAunit_vector helix_vz = cci_helix.axis_dir();
-    SPAunit_vector helix_vy = normalise(helix_vz * helix_vx);
-
-    // 公式推导
-    SPAposition ZeroPos(0, 0, 0);
-    SPAmatrix trans_mat(helix_vx, helix_vy, helix_vz);
-    SPAposition p2 = ZeroPos + trans_mat * (cci_straight.root_point - helix_center);
-    SPAunit_vector d2 = normalise(trans_mat * cci_straight.direction);
-
-    double r = cci_helix.radius();
-    double p = cci_helix.pitch() / (2 * M_PI);
-    double a = d2.z() * p;
-    double b = d2 % p2;
-    double c = p * p;
-    double d = p * p2.z();
-    double e = 1.0;
-    double f = r * r + (p2 - ZeroPos) % (p2 - ZeroPos);
-
-    std::string str_Du = std::format("{}*cos(v)+{}*sin(v)+{}*v+{}*u+{}", -2 * r * d2.x(), -2 * r * d2.y(), -2 * a, 2, 2 * b);
-    std::string str_Dv = std::format("{}*({}*u+{})*sin(v)+{}*({}*u+{})*cos(v)+{}*u+{}*v+{}", 2 * r, d2.x(), p2.x(), -2 * r, d2.y(), p2.y(), -2 * a, 2 * c, -2 * d);
-    std::string str_Duu = std::format("2");
-    std::string str_Duv = std::format("{}*sin(v)+{}*cos(v)+{}", 2 * r * d2.x(), -2 * r * d2.y(), -2 * a);
-    std::string str_Dvu = str_Duv;
-    std::string str_Dvv = std::format("{}*({}*u+{})*cos(v)+{}*({}*u+{})*sin(v)+{}", 2 * r, d2.x(), p2.x(), 2 * r, d2.y(), p2.y(), 2 * c);
-    std::vector<std::string> str_Fs = {str_Du, str_Dv};
-    std::vector<std::string> str_Js = {str_Duu, str_Duv, str_Dvu, str_Dvv};
-    law* law_Fs[2] = {nullptr};
-    law* law_Js[4] = {nullptr};
-    for(int i = 0; i < 2; ++i) {
-        api_str_to_law(str_Fs[i].c_str(), &law_Fs[i]);
-    }
-    for(int i = 0; i < 4; ++i) {
-        api_str_to_law(str_Js[i].c_str(), &law_Js[i]);
-    }
-    double x_init[2] = {cci_straight.param(init_pos), cci_helix.param(init_pos)};
-    double* x_out = nullptr;
-    logical converged = bivariant_newton_iterate(x_init, law_Fs, law_Js, &x_out, 1e-6);
-    pt1 = cci_straight.eval_position(x_out[0]);
-    pt1 = cci_helix.eval_position(x_out[1]);
-    // 销毁law和收敛结果
-    ACIS_DELETE[] STD_CAST x_out;
-    for(int i = 0; i < 2; ++i) {
-        if(law_Fs[i]) {
-            law_Fs[i]->remove();
-            law_Fs[i] = nullptr;
-        }
-    }
-    for(int i = 0; i < 4; ++i) {
-        if(law_Js[i]) {
-            law_Js[i]->remove();
-            law_Js[i] = nullptr;
-        }
-    }
-    return converged;
+    Vector<2> x0({cci_straight.param(init_pos), cci_helix.param(init_pos)});
+    CciNewton2dResult result = cci_newton_min_distance(cci_straight, cci_helix, x0, 1e-6);
+    pt1 = cci_straight.eval_position(result.x(0, 0));
+    pt2 = cci_helix.eval_position(result.x(1, 0));
+    return result.converged;
 }
 
 /**
@@ -6326,75 +7876,54 @@ logical MinDistancePointPair(ellipse const& cci_ellipse, helix const& cci_helix,
 
     // @todo: param函数未解耦:耗时过长暂不解耦
     cci_ellipse.closest_point(init_pos, foot);
-    double init_param1 = cci_ellipse.param(foot);
-    double init_param2 = cci_helix.param(init_pos);
-
-    SPAunit_vector hel_vx = cci_helix.maj_dir();
-    SPAunit_vector hel_vz = cci_helix.axis_dir();
-    SPAunit_vector hel_vy = normalise(hel_vz * hel_vx);
-
-    SPAmatrix trans_mat(hel_vx, hel_vy, hel_vz);
-    SPAposition ell_center_loc = SPAposition(0, 0, 0) + trans_mat * (cci_ellipse.centre - cci_helix.axis_root());
-    SPAunit_vector ell_vx_loc = normalise(trans_mat * cci_ellipse.major_axis);
-    SPAunit_vector ell_vz_loc = normalise(trans_mat * cci_ellipse.normal);
-    SPAunit_vector ell_vy_loc = normalise(trans_mat * (cci_ellipse.normal * cci_ellipse.major_axis));
-
-    double x0 = ell_center_loc.coordinate(0), y0 = ell_center_loc.coordinate(1), z0 = ell_center_loc.coordinate(2);
-    double r1 = cci_helix.radius();
-    double r2 = cci_ellipse.major_axis.len() * cci_ellipse.radius_ratio;
-    double p = cci_helix.pitch() / (2 * M_PI);
-
-    std::string str_t1 = std::format("(({}-{}*cos(v))^2+({}-{}*sin(v))^2+({}-{}*v)^2)", x0, r1, y0, r1, z0, p);
-    std::string str_t2 = std::format("({}*({}-{}*cos(v))+{}*({}-{}*sin(v))+{}*({}-{}*v))", ell_vx_loc.x(), x0, r1, ell_vx_loc.y(), y0, r1, ell_vx_loc.z(), z0, p);
-    std::string str_t3 = std::format("({}*({}-{}*cos(v)+{}*({}-{}*sin(v))+{}*({}-{}*v)))", ell_vy_loc.x(), x0, r1, ell_vy_loc.y(), y0, r1, ell_vy_loc.z(), z0, p);
-
-    std::string str_t1t = std::format("({}*sin(v)-{}*cos(v)+{}*v-{})", 2 * x0 * r1, 2 * y0 * r1, 2 * p * p, 2 * p * z0);
-    std::string str_t2t = std::format("({}*sin(v)-{}*cos(v)-{})", r1 * ell_vx_loc.x(), r1 * ell_vx_loc.y(), p * ell_vx_loc.z());
-    std::string str_t3t = std::format("({}*sin(v)-{}*cos(v)-{})", r1 * ell_vy_loc.x(), r1 * ell_vy_loc.y(), p * ell_vy_loc.z());
-
-    std::string str_t1tt = std::format("({}*cos(v)+{}*sin(v)+{})", 2 * x0 * r1, 2 * y0 * r1, 2 * p * p);
-    std::string str_t2tt = std::format("({}*cos(v)+{}*sin(v))", r1 * ell_vx_loc.x(), r1 * ell_vx_loc.y());
-    std::string str_t3tt = std::format("({}*cos(v)+{}*sin(v))", r1 * ell_vy_loc.x(), r1 * ell_vy_loc.y());
-
-    // 构造方程组law
-    double x_init[2] = {init_param1, init_param2};
-    std::vector<std::string> str_F(2);
-    str_F[0] = std::format("-{}*{}*sin(u)+{}*{}*cos(u)", 2 * r2, str_t2, 2 * r2, str_t3);
-    str_F[1] = std::format("{}+{}*{}*cos(u)+{}*{}*sin(u)", str_t1t, 2 * r2, str_t2t, 2 * r2, str_t3t);
-    std::vector<std::string> str_J(4);
-    str_J[0] = std::format("-{}*{}*cos(u)-{}*{}*sin(u)", 2 * r2, str_t2, 2 * r2, str_t3);
-    str_J[1] = std::format("-{}*{}*sin(u)-{}*{}*cos(u)", 2 * r2, str_t2t, 2 * r2, str_t3t);
-    str_J[2] = str_J[1];
-    str_J[3] = std::format("{}+{}*{}*cos(u)+{}*{}*sin(u)", str_t1tt, 2 * r2, str_t2tt, 2 * r2, str_t3tt);
-
-    law* law_F[2] = {nullptr};
-    law* law_J[4] = {nullptr};
-    for(int i = 0; i < 2; ++i) {
-        api_str_to_law(str_F[i].c_str(), &law_F[i]);
-    }
-    for(int i = 0; i < 4; ++i) {
-        api_str_to_law(str_J[i].c_str(), &law_J[i]);
-    }
+    Vector<2> x0({cci_ellipse.param(foot), cci_helix.param(init_pos)});
+    CciNewton2dResult result = cci_newton_min_distance(cci_ellipse, cci_helix, x0, SPAresabs / 100);
+    pt1 = cci_ellipse.eval_position(result.x(0, 0));
+    pt2 = cci_helix.eval_position(result.x(1, 0));
+    return result.converged;
+}
 
-    // 牛顿迭代，获得局部最小值点对
-    double* answer = nullptr;
-    logical converged = bivariant_newton_iterate(x_init, law_F, law_J, &answer, SPAresabs / 100);
-    pt1 = cci_ellipse.eval_position(answer[0]);
-    pt2 = cci_helix.eval_position(answer[1]);
+CciNewton2dResult cci_newton_min_distance(curve const& cur1, curve const& cur2, Vector<2> const& x0, double tol) {
+    auto residual = [&cur1, &cur2](Vector<2> const& x, Vector<2>& F) {
+        SPAposition p1, p2;
+        SPAvector u1, v1;
+        cur1.eval(x(0, 0), p1, u1);
+        cur2.eval(x(1, 0), p2, v1);
+        SPAvector dis_vec = p1 - p2;
+        F(0, 0) = dis_vec % u1;
+        F(1, 0) = -(dis_vec % v1);
+    };
+    // 距离平方一半的Hessian矩阵即残差的Jacobian矩阵
+    CurveDistanceObjective objective{cur1, cur2};
+    auto jacobian = [&objective](Vector<2> const& x, Matrix<2, 2>& J) {
+        Vector<2> grad;
+        objective(x, grad, J);
+    };
+    SPAinterval unbounded(interval_type::interval_infinite);
+    SPAinterval range1 = cur1.periodic() ? unbounded : cur1.param_range();
+    SPAinterval range2 = cur2.periodic() ? unbounded : cur2.param_range();
+    return cci_newton_solve_2d(residual, jacobian, x0, range1, range2, tol, SPAresnor);
+}
 
-    ACIS_DELETE[] STD_CAST answer;
-    // 销毁law
-    for(int i = 0; i < 2; ++i) {
-        if(law_F[i]) {
-            law_F[i]->remove();
+void cci_newton_polish_inters(curve const& cur1, curve const& cur2, curve_curve_int* inters, double tol) {
+    for(curve_curve_int* inter = inters; inter; inter = inter->next) {
+        if(cci_check_coin(inter)) {
+            continue;
         }
-    }
-    for(int i = 0; i < 4; ++i) {
-        if(law_J[i]) {
-            law_J[i]->remove();
+        CciNewton2dResult result = cci_newton_min_distance(cur1, cur2, Vector<2>({inter->param1, inter->param2}), SPAresabs * SPAresabs);
+        if(!result.converged) {
+            continue;
+        }
+        SPAposition pt1 = cur1.eval_position(result.x(0, 0));
+        SPAposition pt2 = cur2.eval_position(result.x(1, 0));
+        SPAposition int_point = mid_point(pt1, pt2);
+        // 只接受同一交点附近的精化结果，避免跳到其他交点
+        if(distance_to_point(pt1, pt2) <= tol && distance_to_point(int_point, inter->int_point) <= tol) {
+            inter->int_point = int_point;
+            inter->param1 = result.x(0, 0);
+            inter->param2 = result.x(1, 0);
         }
     }
-    return converged;
 }
 
 /**
@@ -6592,6 +8121,477 @@ void save_curve_curve_models(curve const& cur1, curve const& cur2, std::string c
     my_save_entity_list(edge_list, file_name.c_str());
 }
 
+void save_curve_curve_corpus(curve const& cur1, curve const& cur2, std::string const& file_name, SPAbox const& box, double tol) {
+    curve_curve_int* inters = int_cur_cur(cur1, cur2, box, tol);
+    CciCorpusWriter writer(file_name);
+    writer.write(cur1, cur2, inters, box, tol);
+    delete_curve_curve_ints(inters);
+}
+
+static_assert(sizeof(CciCorpusHeader) % 8 == 0 && sizeof(CciCorpusRecord) % 8 == 0 && sizeof(CciCorpusCurve) % 8 == 0 && sizeof(CciCorpusInter) % 8 == 0, "语料中的结构体需按8字节对齐");
+
+template <typename T> static void cci_corpus_put(std::vector<char>& out, T const* values, size_t num) {
+    char const* bytes = reinterpret_cast<char const*>(values);
+    out.insert(out.end(), bytes, bytes + num * sizeof(T));
+}
+
+/**
+ * @brief 将一条曲线编码为CciCorpusCurve及其数据，追加到out末尾
+ * @return 曲线类型不支持时返回false
+ */
+static bool cci_corpus_encode_curve(curve const& cur, std::vector<char>& out) {
+    CciCorpusCurve head = {};
+    CciCurveKind kind = cci_curve_kind(cur);
+    head.kind = static_cast<uint32_t>(kind);
+    std::vector<double> values;
+    auto put_xyz = [&values](auto const& v) { values.insert(values.end(), {v.x(), v.y(), v.z()}); };
+    switch(kind) {
+        case CciCurveKind::Straight: {
+            straight const& st = static_cast<straight const&>(cur);
+            put_xyz(st.root_point);
+            put_xyz(st.direction);
+            values.push_back(st.param_scale);
+            break;
+        }
+        case CciCurveKind::Ellipse: {
+            ellipse const& ell = static_cast<ellipse const&>(cur);
+            put_xyz(ell.centre);
+            put_xyz(ell.normal);
+            put_xyz(ell.major_axis);
+            values.push_back(ell.radius_ratio);
+            values.push_back(ell.param_off);
+            break;
+        }
+        case CciCurveKind::Helix: {
+            helix const& hel = static_cast<helix const&>(cur);
+            put_xyz(hel.axis_root());
+            put_xyz(hel.axis_dir());
+            put_xyz(hel.start_disp());
+            values.insert(values.end(), {hel.pitch(), hel.par_scaling(), hel.taper(), hel.helix_range().start_pt(), hel.helix_range().end_pt()});
+            if(hel.handedness()) {
+                head.flags |= CCI_CORPUS_HANDEDNESS;
+            }
+            break;
+        }
+        case CciCurveKind::Intcurve: {
+            // 保存参数化与intcurve一致的样条曲线，读取时无需再处理reversed与subset
+            bs3_curve bs3 = cci_intcurve_bs3(static_cast<intcurve const&>(cur));
+            if(!bs3) {
+                return false;
+            }
+            int dim = 0, num_ctrlpts = 0, num_knots = 0;
+            logical rational = FALSE;
+            SPAposition* ctrlpts = nullptr;
+            double *weights = nullptr, *knots = nullptr;
+            bs3_curve_to_array(bs3, dim, head.degree, rational, num_ctrlpts, ctrlpts, weights, num_knots, knots);
+            head.num_ctrlpts = num_ctrlpts;
+            head.num_knots = num_knots;
+            head.flags |= (rational ? CCI_CORPUS_RATIONAL : 0) | (bs3_curve_closed(bs3) ? CCI_CORPUS_CLOSED : 0) | (bs3_curve_periodic(bs3) ? CCI_CORPUS_PERIODIC : 0);
+            for(int i = 0; i < num_ctrlpts; ++i) {
+                put_xyz(ctrlpts[i]);
+            }
+            if(rational) {
+                values.insert(values.end(), weights, weights + num_ctrlpts);
+            }
+            values.insert(values.end(), knots, knots + num_knots);
+            ACIS_DELETE[] ctrlpts;
+            ACIS_DELETE[] STD_CAST weights;
+            ACIS_DELETE[] STD_CAST knots;
+            bs3_curve_delete(bs3);
+            break;
+        }
+        default:
+            return false;
+    }
+    if(kind != CciCurveKind::Intcurve && cur.subsetted()) {
+        head.flags |= CCI_CORPUS_SUBSET;
+        head.subset[0] = cur.param_range().start_pt();
+        head.subset[1] = cur.param_range().end_pt();
+    }
+    head.num_values = static_cast<int32_t>(values.size());
+    cci_corpus_put(out, &head, 1);
+    cci_corpus_put(out, values.data(), values.size());
+    return true;
+}
+
+bool cci_corpus_encode(curve const& c1, curve const& c2, curve_curve_int const* expected, SPAbox const& box, double tol, std::vector<char>& record, uint32_t flags, uint32_t elapsed_us) {
+    size_t start = record.size();
+    CciCorpusRecord head = {};
+    head.flags = flags;
+    head.elapsed_us = elapsed_us;
+    head.tol = tol;
+    if(&box) {
+        head.flags |= CCI_CORPUS_HAS_BOX;
+        for(int i = 0; i < 3; ++i) {
+            head.box[i] = box.low().coordinate(i);
+            head.box[i + 3] = box.high().coordinate(i);
+        }
+    }
+    for(curve_curve_int const* inter = expected; inter; inter = inter->next) {
+        ++head.num_expected;
+    }
+    cci_corpus_put(record, &head, 1);
+    if(!cci_corpus_encode_curve(c1, record) || !cci_corpus_encode_curve(c2, record)) {
+        record.resize(start);
+        return false;
+    }
+    for(curve_curve_int const* inter = expected; inter; inter = inter->next) {
+        CciCorpusInter value = {
+          {inter->int_point.x(), inter->int_point.y(), inter->int_point.z()},
+          inter->param1, inter->param2, static_cast<int32_t>(inter->low_rel), static_cast<int32_t>(inter->high_rel)
+        };
+        cci_corpus_put(record, &value, 1);
+    }
+    uint32_t size = static_cast<uint32_t>(record.size() - start);
+    memcpy(record.data() + start + offsetof(CciCorpusRecord, size), &size, sizeof(size));
+    return true;
+}
+
+/**
+ * @brief 检查曲线头部的类型、样条曲线的阶数与个数，以及曲线数据的double个数是否与类型一致
+ */
+static bool cci_corpus_curve_valid(CciCorpusCurve const& head) {
+    int64_t expected = -1;
+    switch(static_cast<CciCurveKind>(head.kind)) {
+        case CciCurveKind::Straight:
+            expected = 7;  // root_point, direction, param_scale
+            break;
+        case CciCurveKind::Ellipse:
+            expected = 11;  // centre, normal, major_axis, radius_ratio, param_off
+            break;
+        case CciCurveKind::Helix:
+            expected = 14;  // axis_root, axis_dir, start_disp, pitch, par_scaling, taper, helix_range
+            break;
+        case CciCurveKind::Intcurve:
+            if(head.degree < 1 || head.num_ctrlpts <= head.degree || head.num_knots <= 0) {
+                return false;
+            }
+            expected = int64_t((head.flags & CCI_CORPUS_RATIONAL) ? 4 : 3) * head.num_ctrlpts + head.num_knots;
+            break;
+        default:
+            return false;
+    }
+    return head.num_values == expected;
+}
+
+curve* CciCorpusPair::make_curve(int k) const {
+    CciCorpusCurve const& head = *curves[k];
+    if(!cci_corpus_curve_valid(head)) {
+        return nullptr;
+    }
+    double const* v = values[k];
+    curve* cur = nullptr;
+    switch(static_cast<CciCurveKind>(head.kind)) {
+        case CciCurveKind::Straight:
+            cur = ACIS_NEW straight(SPAposition(v[0], v[1], v[2]), SPAunit_vector(v[3], v[4], v[5]), v[6]);
+            break;
+        case CciCurveKind::Ellipse:
+            cur = ACIS_NEW ellipse(SPAposition(v[0], v[1], v[2]), SPAunit_vector(v[3], v[4], v[5]), SPAvector(v[6], v[7], v[8]), v[9], v[10]);
+            break;
+        case CciCurveKind::Helix:
+            cur = ACIS_NEW helix(SPAposition(v[0], v[1], v[2]), SPAunit_vector(v[3], v[4], v[5]), SPAvector(v[6], v[7], v[8]), v[9], (head.flags & CCI_CORPUS_HANDEDNESS) != 0, SPAinterval(v[12], v[13]), v[10], v[11]);
+            break;
+        case CciCurveKind::Intcurve: {
+            bool rational = head.flags & CCI_CORPUS_RATIONAL;
+            int num_ctrlpts = head.num_ctrlpts;
+            std::vector<SPAposition> ctrlpts(num_ctrlpts);
+            for(int i = 0; i < num_ctrlpts; ++i) {
+                ctrlpts[i] = SPAposition(v[3 * i], v[3 * i + 1], v[3 * i + 2]);
+            }
+            double const* weights = rational ? v + 3 * num_ctrlpts : nullptr;
+            double const* knots = v + (rational ? 4 : 3) * num_ctrlpts;
+            bs3_curve bs3 = bs3_curve_from_ctrlpts(head.degree, rational, (head.flags & CCI_CORPUS_CLOSED) != 0, (head.flags & CCI_CORPUS_PERIODIC) != 0, num_ctrlpts, ctrlpts.data(), weights, SPAresabs, head.num_knots, knots, SPAresnor);
+            if(!bs3) {
+                return nullptr;
+            }
+            cur = ACIS_NEW intcurve(ACIS_NEW exact_int_cur(bs3));
+            break;
+        }
+        default:
+            return nullptr;
+    }
+    if(head.flags & CCI_CORPUS_SUBSET) {
+        cur->limit(SPAinterval(head.subset[0], head.subset[1]));
+    }
+    return cur;
+}
+
+curve_curve_int* CciCorpusPair::make_expected() const {
+    curve_curve_int* inters = nullptr;
+    for(int i = static_cast<int>(record->num_expected) - 1; i >= 0; --i) {
+        CciCorpusInter const& value = expected[i];
+        inters = ACIS_NEW curve_curve_int(inters, SPAposition(value.point[0], value.point[1], value.point[2]), value.param1, value.param2);
+        inters->low_rel = static_cast<curve_curve_rel>(value.low_rel);
+        inters->high_rel = static_cast<curve_curve_rel>(value.high_rel);
+    }
+    return inters;
+}
+
+SPAbox CciCorpusPair::box() const {
+    double const* b = record->box;
+    return SPAbox(SPAposition(b[0], b[1], b[2]), SPAposition(b[3], b[4], b[5]));
+}
+
+bool CciCorpusView::init(void const* data, size_t size) {
+    base = static_cast<char const*>(data);
+    offsets.clear();
+    CciCorpusHeader const* header = static_cast<CciCorpusHeader const*>(data);
+    if(!data || size < sizeof(CciCorpusHeader) || memcmp(header->magic, CCI_CORPUS_MAGIC, sizeof(CCI_CORPUS_MAGIC)) != 0 || header->version != CCI_CORPUS_VERSION || header->byte_order != CCI_CORPUS_BYTE_ORDER) {
+        return false;
+    }
+    // 沿记录长度及各段长度检查记录的完整性，并检查曲线数据的个数与曲线类型一致，不读取曲线数据
+    size_t offset = sizeof(CciCorpusHeader);
+    while(offset < size) {
+        CciCorpusRecord const* record = reinterpret_cast<CciCorpusRecord const*>(base + offset);
+        if(size - offset < sizeof(CciCorpusRecord) || record->size % 8 != 0 || record->size > size - offset) {
+            offsets.clear();
+            return false;
+        }
+        size_t used = sizeof(CciCorpusRecord);
+        for(int k = 0; k < 2; ++k) {
+            CciCorpusCurve const* cur = reinterpret_cast<CciCorpusCurve const*>(base + offset + used);
+            if(used + sizeof(CciCorpusCurve) > record->size || !cci_corpus_curve_valid(*cur)) {
+                offsets.clear();
+                return false;
+            }
+            used += sizeof(CciCorpusCurve) + cur->num_values * sizeof(double);
+        }
+        if(used + record->num_expected * sizeof(CciCorpusInter) != record->size) {
+            offsets.clear();
+            return false;
+        }
+        offsets.push_back(offset);
+        offset += record->size;
+    }
+    return true;
+}
+
+CciCorpusPair CciCorpusView::operator[](size_t i) const {
+    CciCorpusPair pair;
+    char const* p = base + offsets[i];
+    pair.record = reinterpret_cast<CciCorpusRecord const*>(p);
+    p += sizeof(CciCorpusRecord);
+    for(int k = 0; k < 2; ++k) {
+        pair.curves[k] = reinterpret_cast<CciCorpusCurve const*>(p);
+        p += sizeof(CciCorpusCurve);
+        pair.values[k] = reinterpret_cast<double const*>(p);
+        p += pair.curves[k]->num_values * sizeof(double);
+    }
+    pair.expected = reinterpret_cast<CciCorpusInter const*>(p);
+    return pair;
+}
+
+CciCorpusFile::~CciCorpusFile() {
+    close();
+}
+
+bool CciCorpusFile::open(std::string const& file_name) {
+    close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    file_handle = file;
+    LARGE_INTEGER file_size;
+    if(!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        close();
+        return false;
+    }
+    mapping_handle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    mapped = mapping_handle ? MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    length = static_cast<size_t>(file_size.QuadPart);
+#else
+    int fd = ::open(file_name.c_str(), O_RDONLY);
+    if(fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // 映射建立后不再需要文件描述符
+    mapped = data == MAP_FAILED ? nullptr : data;
+    length = static_cast<size_t>(file_stat.st_size);
+#endif
+    if(!mapped || !init(mapped, length)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CciCorpusFile::close() {
+    offsets.clear();
+    base = nullptr;
+#ifdef _WIN32
+    if(mapped) {
+        UnmapViewOfFile(mapped);
+    }
+    if(mapping_handle) {
+        CloseHandle(mapping_handle);
+    }
+    if(file_handle) {
+        CloseHandle(file_handle);
+    }
+    mapping_handle = file_handle = nullptr;
+#else
+    if(mapped) {
+        munmap(mapped, length);
+    }
+#endif
+    mapped = nullptr;
+    length = 0;
+}
+
+CciCorpusWriter::CciCorpusWriter(std::string const& file_name) {
+    file = fopen(file_name.c_str(), "ab");
+    if(file && fseek(file, 0, SEEK_END) == 0 && ftell(file) == 0) {
+        CciCorpusHeader header = {};
+        memcpy(header.magic, CCI_CORPUS_MAGIC, sizeof(CCI_CORPUS_MAGIC));
+        header.version = CCI_CORPUS_VERSION;
+        header.byte_order = CCI_CORPUS_BYTE_ORDER;
+        fwrite(&header, sizeof(header), 1, file);
+    }
+}
+
+CciCorpusWriter::~CciCorpusWriter() {
+    if(file) {
+        fclose(file);
+    }
+}
+
+bool CciCorpusWriter::write(curve const& c1, curve const& c2, curve_curve_int const* expected, SPAbox const& box, double tol) {
+    if(!file) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    buffer.clear();
+    if(!cci_corpus_encode(c1, c2, expected, box, tol, buffer)) {
+        return false;
+    }
+    return write_locked(buffer);
+}
+
+bool CciCorpusWriter::append(std::vector<char> const& record) {
+    if(!file) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    return write_locked(record);
+}
+
+bool CciCorpusWriter::write_locked(std::vector<char> const& record) {
+    // 每条记录写完即刷新，进程异常退出时已收集的记录仍然完整
+    bool written = fwrite(record.data(), 1, record.size(), file) == record.size();
+    return fflush(file) == 0 && written;
+}
+
+// 调用记录器的状态，原子变量在每次调用时无锁读取，其余状态由cci_recorder_mutex保护
+static std::atomic<bool> cci_recorder_on{false};
+static std::atomic<double> cci_recorder_min_seconds{0.0};
+static std::atomic<int> cci_recorder_sample_every{1};
+static std::atomic<long long> cci_recorder_qualified{0};  // 满足耗时要求的调用次数，用于采样
+static std::atomic<long long> cci_recorder_recorded{0};
+static std::mutex cci_recorder_mutex;
+static CciRecorderOptions cci_recorder_options;
+static std::unique_ptr<CciCorpusWriter> cci_recorder_writer;
+static std::deque<std::vector<char>> cci_recorder_ring;
+static thread_local int cci_record_depth = 0;  // 当前线程answer_int_cur_cur的嵌套层数
+
+bool cci_recorder_start(CciRecorderOptions const& options) {
+    cci_recorder_stop();
+    std::lock_guard<std::mutex> lock(cci_recorder_mutex);
+    if(!options.file_name.empty()) {
+        auto writer = std::make_unique<CciCorpusWriter>(options.file_name);
+        if(!writer->is_open()) {
+            return false;
+        }
+        cci_recorder_writer = std::move(writer);
+    }
+    cci_recorder_options = options;
+    cci_recorder_min_seconds = options.min_seconds;
+    cci_recorder_sample_every = std::max(options.sample_every, 1);
+    cci_recorder_ring.clear();
+    cci_recorder_qualified = 0;
+    cci_recorder_recorded = 0;
+    cci_recorder_on = true;
+    return true;
+}
+
+void cci_recorder_stop() {
+    std::lock_guard<std::mutex> lock(cci_recorder_mutex);
+    cci_recorder_on = false;
+    cci_recorder_writer.reset();
+}
+
+bool cci_recorder_enabled() {
+    return cci_recorder_on.load(std::memory_order_relaxed);
+}
+
+long long cci_recorder_count() {
+    return cci_recorder_recorded;
+}
+
+bool cci_recorder_dump(std::string const& file_name) {
+    CciCorpusWriter writer(file_name);
+    std::lock_guard<std::mutex> lock(cci_recorder_mutex);
+    if(!writer.is_open()) {
+        return false;
+    }
+    for(auto const& record: cci_recorder_ring) {
+        if(!writer.append(record)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+CciRecordScope::CciRecordScope(curve const& c1, curve const& c2, SPAbox const& box, double tol): c1(c1), c2(c2), box(box), tol(tol), active(cci_recorder_enabled() && cci_record_depth == 0) {
+    if(active) {
+        ++cci_record_depth;
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+CciRecordScope::~CciRecordScope() {
+    if(active) {
+        --cci_record_depth;
+    }
+}
+
+void CciRecordScope::finish(curve_curve_int const* result) {
+    if(!active) {
+        return;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    // 采样判断不加锁，只有被记录的调用才编码并进入临界区
+    if(seconds < cci_recorder_min_seconds || cci_recorder_qualified.fetch_add(1) % cci_recorder_sample_every != 0) {
+        return;
+    }
+    uint32_t elapsed_us = static_cast<uint32_t>(std::min(seconds * 1e6, 4294967295.0));
+    std::vector<char> record;
+    if(!cci_corpus_encode(c1, c2, result, box, tol, record, CCI_CORPUS_RECORDED, elapsed_us)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(cci_recorder_mutex);
+    if(!cci_recorder_on) {
+        return;
+    }
+    ++cci_recorder_recorded;
+    if(cci_recorder_writer) {
+        cci_recorder_writer->append(record);
+    }
+    if(cci_recorder_options.ring_capacity > 0) {
+        if(cci_recorder_ring.size() >= cci_recorder_options.ring_capacity) {
+            cci_recorder_ring.pop_front();
+        }
+        cci_recorder_ring.push_back(std::move(record));
+    }
+}
+
 double MinDistancePointPair(curve const& cur1, curve const& cur2, SPAposition& pt1, SPAposition& pt2) {
     eed_output_handle* eoh = nullptr;
 
@@ -6669,26 +8669,58 @@ bool intcurve_is_circle(bs3_curve curv1, double tol) {
     return flag;
 }
 
+CciPointGrid::CciPointGrid(double size, size_t expected): cell_size(size) {
+    if(expected > 0) {
+        cells.reserve(expected);
+    }
+}
+
+CciPointGrid::CellKey CciPointGrid::key_of(SPAposition const& pos) const {
+    // 截断到1e15以内，避免远处的点转换为整数时溢出
+    auto cell = [this](double coord) { return static_cast<long long>(std::floor(std::clamp(coord / cell_size, -1e15, 1e15))); };
+    return CellKey{cell(pos.x()), cell(pos.y()), cell(pos.z())};
+}
+
+void CciPointGrid::insert(SPAposition const& pos, int id) {
+    cells[key_of(pos)].push_back(id);
+}
+
 int CurvCurvIntPointReduce(curve_curve_int*& rt_raw) {
+    CCI_STAT_TIMER(point_reduce);
     // 交点剔除策略
     // 1, 当两个交点距离在容差内(SPAresabs)，则需要剔除其中一个交点
     // 2, 交点关系为normal的交点和交点关系为tangent的交点，优先剔除交点关系为normal的交点
     // 3，多个交点关系为tangent的交点，保留第一个交点
     // 4，优先保留交点关系为coin的交点，若多个交点关系为coin的交点则不处理
-    curve_curve_int* ret = nullptr;
-    for(auto cur = rt_raw; cur; cur = cur->next) {
-        for(auto next = cur->next, next_pre = cur; next; next_pre = next, next = next->next) {
-            if((!cci_check_coin(cur) || !cci_check_coin(next)) && distance_to_point(cur->int_point, next->int_point) <= SPAresabs) {
-                if(!cci_check_tangent(cur) && !cci_check_coin(cur) && cci_check_tangent(next) || cci_check_coin(next)) {
-                    auto cur_next = cur->next;
-                    *cur = *next;
-                    cur->next = cur_next;
-                }
-                next_pre->next = next->next;
-                ACIS_DELETE next;
-                next = next_pre;
-            }
+    // 按链表顺序逐个处理，每个交点只与网格中邻近的已保留交点比较，与链表中最靠前的匹配交点合并
+    std::vector<curve_curve_int*> kept;  // 已保留的交点，下标即网格中记录的编号
+    CciPointGrid grid(SPAresabs, count_inters(rt_raw));
+    for(auto cur = rt_raw; cur;) {
+        curve_curve_int* next = cur->next;
+        int match = -1;
+        grid.visit_near(cur->int_point, [&](int id) {
+            curve_curve_int* rep = kept[id];
+            if((match < 0 || id < match) && (!cci_check_coin(rep) || !cci_check_coin(cur)) && distance_to_point(rep->int_point, cur->int_point) <= SPAresabs) {
+                match = id;
+            }
+        });
+        cur->next = nullptr;
+        if(match < 0) {
+            grid.insert(cur->int_point, static_cast<int>(kept.size()));
+            kept.push_back(cur);
+        } else if(!cci_check_tangent(kept[match]) && !cci_check_coin(kept[match]) && cci_check_tangent(cur) || cci_check_coin(cur)) {
+            // cur取代已保留交点的位置，交点位置变化后在新网格中重新登记
+            cci_delete_inter(kept[match]);
+            kept[match] = cur;
+            grid.insert(cur->int_point, match);
+        } else {
+            cci_delete_inter(cur);
         }
+        cur = next;
+    }
+    for(size_t i = 1; i < kept.size(); ++i) {
+        kept[i - 1]->next = kept[i];
     }
-    return count_inters(rt_raw);
+    rt_raw = kept.empty() ? nullptr : kept.front();
+    return static_cast<int>(kept.size());
 }